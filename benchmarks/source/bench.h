@@ -0,0 +1,89 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    Timing and key generation helpers shared by the benchmark programs
+ */
+
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+
+#include <stdint.h>
+#include <time.h>
+
+
+/*
+    The unit reported by Bench_Ticks.  Time stamp counter cycles are used where available,
+    falling back to nanoseconds elsewhere
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH__TICK_UNIT "cycles"
+#else
+#define BENCH__TICK_UNIT "ns"
+#endif
+
+
+static inline uint64_t
+Bench_Ticks (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec*1000000000u+(uint64_t)now.tv_nsec;
+#endif
+}
+
+static inline double
+Bench_Seconds (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec+(double)now.tv_nsec*1e-9;
+}
+
+/*
+    A small xorshift generator so that every benchmark run sees the same key sequence
+ */
+static inline uint64_t
+Bench_Random (uint64_t* state)
+{
+    uint64_t x;
+
+    x  = *state;
+    x ^= x<<13;
+    x ^= x>>7;
+    x ^= x<<17;
+
+    *state = x;
+
+    return x;
+}
+
+
+#endif
@@ -0,0 +1,211 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the throughput of looking up keys one at a time with Container_LookupHashNode
+    against Container_LookupHashNodeBatch, for batch sizes typical of a request handler.  The
+    table is much larger than the last level cache, so nearly every bucket and node access of
+    the serial loop is a cache miss
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define TABLE_SHIFT     22
+#define LOOKUP_COUNT    (1u << 22)
+#define MAX_BATCH_COUNT 256u
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+RunSerial (unsigned int, struct container__hash* restrict, unsigned int* restrict);
+
+static void
+RunBatch (unsigned int, struct container__hash* restrict, unsigned int* restrict);
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+RunSerial (
+           unsigned int                     batch_count,
+           struct container__hash* restrict hash,
+           unsigned int* restrict           keys
+          )
+{
+    struct container__hash_bucket* searched_bucket;
+    uint64_t                       start_ticks;
+    uint64_t                       total_ticks;
+    unsigned int                   found_count;
+
+    found_count = 0;
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int start = 0; start < LOOKUP_COUNT; start += batch_count)
+    {
+        for(unsigned int index = start; index < start+batch_count; index++)
+        {
+            struct container__hash_node* found_node;
+
+            found_node = Container_LookupHashNode(
+                                                  keys[index],
+                                                  &keys[index],
+                                                  hash,
+                                                  &BenchLookup,
+                                                  NULL,
+                                                  &searched_bucket
+                                                 );
+            if(found_node != NULL)
+                found_count++;
+        }
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf(
+           "batch of %3u, serial %10.1f %s/lookup (%u found)\n",
+           batch_count,
+           (double)total_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           found_count
+          );
+}
+
+static void
+RunBatch (
+          unsigned int                     batch_count,
+          struct container__hash* restrict hash,
+          unsigned int* restrict           keys
+         )
+{
+    struct container__hash_node* found_nodes[MAX_BATCH_COUNT];
+    void*                        values[MAX_BATCH_COUNT];
+    uint64_t                     start_ticks;
+    uint64_t                     total_ticks;
+    unsigned int                 found_count;
+
+    found_count = 0;
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int start = 0; start < LOOKUP_COUNT; start += batch_count)
+    {
+        for(unsigned int index = 0; index < batch_count; index++)
+            values[index] = &keys[start+index];
+
+        Container_LookupHashNodeBatch(
+                                      batch_count,
+                                      &keys[start],
+                                      values,
+                                      hash,
+                                      &BenchLookup,
+                                      NULL,
+                                      found_nodes
+                                     );
+
+        for(unsigned int index = 0; index < batch_count; index++)
+        {
+            if(found_nodes[index] != NULL)
+                found_count++;
+        }
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf(
+           "batch of %3u, batched %9.1f %s/lookup (%u found)\n",
+           batch_count,
+           (double)total_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           found_count
+          );
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct bench_entry*        entries;
+    unsigned int*              keys;
+    struct container__hash     hash;
+    enum container__error_code error;
+    uint64_t                   random_state;
+    unsigned int               node_count;
+
+    node_count = 1u<<TABLE_SHIFT;
+    entries    = malloc(sizeof(*entries)*node_count);
+    keys       = malloc(sizeof(*keys)*LOOKUP_COUNT);
+    if(entries == NULL || keys == NULL)
+        return EXIT_FAILURE;
+
+    error = Container_CreateHashShift(TABLE_SHIFT, &hash);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < node_count; index++)
+    {
+        entries[index].key = (unsigned int)Bench_Random(&random_state);
+
+        Container_AddHashNode(entries[index].key, &entries[index].node, &hash);
+    }
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        keys[index] = entries[Bench_Random(&random_state)%node_count].key;
+
+    for(unsigned int batch_count = 32; batch_count <= MAX_BATCH_COUNT; batch_count *= 2)
+    {
+        RunSerial(batch_count, &hash, keys);
+        RunBatch(batch_count, &hash, keys);
+    }
+
+    Container_DestroyHash(&hash);
+    free(keys);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,318 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the blob equality functions with memcmp, first on pairs of equal keys of several
+    lengths, so that every byte must be read, and then as the comparison made by hash lookups.
+    The lookups use 16 and 32 byte keys and 48 byte keys of any length.  Keys share all but
+    their last bytes and the table is overloaded, so each lookup compares several nodes whose
+    keys differ only at the end
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/blob.h>
+#include <container/stdhash.h>
+
+#include "bench.h"
+
+
+#define PAIR_COUNT   32
+#define PAIR_ROUNDS  32768
+#define MAX_SIZE     256
+#define KEY_COUNT    (1u << 18)
+#define BUCKET_SHIFT 15
+#define LOOKUP_COUNT (1u << 22)
+#define KEY_SIZE     48
+
+
+static unsigned char*                      bench_left;
+static unsigned char*                      bench_right;
+static unsigned char*                      bench_bytes;
+static struct container__blob*             bench_keys;
+static struct container__blob16_hash_node* bench_blob16_nodes;
+static struct container__blob32_hash_node* bench_blob32_nodes;
+static struct container__blob_hash_node*   bench_blob_nodes;
+static unsigned int*                       bench_lookups;
+static size_t                              bench_size;
+
+
+static void
+RunEqualBenchmark (size_t);
+
+static enum container__hash_cmp_result
+MemcmpLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+RunLookupBenchmark (const char*, size_t);
+
+
+static void
+RunEqualBenchmark (size_t size)
+{
+    uint64_t     memcmp_ticks;
+    uint64_t     blob_ticks;
+    unsigned int equal_count;
+
+    equal_count  = 0;
+    memcmp_ticks = Bench_Ticks();
+
+    for(unsigned int round = 0; round < PAIR_ROUNDS; round++)
+    {
+        for(unsigned int index = 0; index < PAIR_COUNT; index++)
+        {
+            if(memcmp(&bench_left[index*MAX_SIZE], &bench_right[index*MAX_SIZE], size) == 0)
+                equal_count++;
+        }
+    }
+
+    memcmp_ticks = Bench_Ticks()-memcmp_ticks;
+    blob_ticks   = Bench_Ticks();
+
+    for(unsigned int round = 0; round < PAIR_ROUNDS; round++)
+    {
+        for(unsigned int index = 0; index < PAIR_COUNT; index++)
+        {
+            if(Container_BlobEqual(&bench_left[index*MAX_SIZE], &bench_right[index*MAX_SIZE], size))
+                equal_count--;
+        }
+    }
+
+    blob_ticks = Bench_Ticks()-blob_ticks;
+
+    if(equal_count != 0)
+        printf("mismatched comparison results\n");
+
+    printf(
+           "equal %3zu bytes       memcmp %6.1f %s, blob %6.1f %s\n",
+           size,
+           (double)memcmp_ticks/(PAIR_COUNT*PAIR_ROUNDS),
+           BENCH__TICK_UNIT,
+           (double)blob_ticks/(PAIR_COUNT*PAIR_ROUNDS),
+           BENCH__TICK_UNIT
+          );
+}
+
+static enum container__hash_cmp_result
+MemcmpLookup (
+              void*                                 lookup_value,
+              struct container__hash_node* restrict existing_node,
+              void*                                 user_data
+             )
+{
+    struct container__blob_hash_node* existing_blob_node;
+
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob_hash_node,
+                                                 node
+                                                );
+
+    if(memcmp(lookup_value, existing_blob_node->value.bytes, bench_size) == 0)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+RunLookupBenchmark (const char* name, size_t size)
+{
+    struct container__hash hash;
+    uint64_t               memcmp_ticks;
+    uint64_t               blob_ticks;
+    unsigned int           found_count;
+
+    if(Container_CreateHashShift(BUCKET_SHIFT, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    bench_size = size;
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        Container_InitBlob(&bench_bytes[index*KEY_SIZE+KEY_SIZE-size], size, &bench_keys[index]);
+        Container_AddBlobHash(bench_keys[index], &bench_blob_nodes[index], &hash);
+    }
+
+    found_count  = 0;
+    memcmp_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        struct container__blob*        key;
+
+        key = &bench_keys[bench_lookups[index]];
+        if(Container_LookupHashNode(
+                                    key->value_hash,
+                                    (void*)key->bytes,
+                                    &hash,
+                                    &MemcmpLookup,
+                                    NULL,
+                                    &searched_bucket
+                                   ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    memcmp_ticks = Bench_Ticks()-memcmp_ticks;
+
+    Container_ResetHash(&hash);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        struct container__blob16 blob16;
+        struct container__blob32 blob32;
+
+        if(size == CONTAINER__BLOB16_SIZE)
+        {
+            memcpy(blob16.bytes, bench_keys[index].bytes, sizeof(blob16.bytes));
+            Container_AddBlob16HashKey(blob16, &bench_blob16_nodes[index], &hash);
+        }
+        else if(size == CONTAINER__BLOB32_SIZE)
+        {
+            memcpy(blob32.bytes, bench_keys[index].bytes, sizeof(blob32.bytes));
+            Container_AddBlob32HashKey(blob32, &bench_blob32_nodes[index], &hash);
+        }
+        else
+        {
+            Container_AddBlobHashKey(bench_keys[index], &bench_blob_nodes[index], &hash);
+        }
+    }
+
+    blob_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        struct container__blob*        key;
+        void*                          found;
+
+        key = &bench_keys[bench_lookups[index]];
+        if(size == CONTAINER__BLOB16_SIZE)
+        {
+            struct container__blob16 blob16;
+
+            memcpy(blob16.bytes, key->bytes, sizeof(blob16.bytes));
+            found = Container_LookupBlob16HashKey(blob16, &hash, &searched_bucket);
+        }
+        else if(size == CONTAINER__BLOB32_SIZE)
+        {
+            struct container__blob32 blob32;
+
+            memcpy(blob32.bytes, key->bytes, sizeof(blob32.bytes));
+            found = Container_LookupBlob32HashKey(blob32, &hash, &searched_bucket);
+        }
+        else
+        {
+            found = Container_LookupBlobHashKey(*key, &hash, &searched_bucket);
+        }
+
+        if(found != NULL)
+            found_count--;
+    }
+
+    blob_ticks = Bench_Ticks()-blob_ticks;
+
+    if(found_count != 0)
+        printf("mismatched lookup results\n");
+
+    printf(
+           "lookup %-14s memcmp %6.1f %s, blob %6.1f %s\n",
+           name,
+           (double)memcmp_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           (double)blob_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    Container_DestroyHash(&hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    static const size_t equal_sizes[] = {8, 16, 24, 32, 48, 64, 128, 256};
+    uint64_t            random_state;
+
+    bench_left         = malloc((size_t)MAX_SIZE*PAIR_COUNT);
+    bench_right        = malloc((size_t)MAX_SIZE*PAIR_COUNT);
+    bench_bytes        = malloc((size_t)KEY_SIZE*KEY_COUNT);
+    bench_keys         = malloc(sizeof(*bench_keys)*KEY_COUNT);
+    bench_blob16_nodes = malloc(sizeof(*bench_blob16_nodes)*KEY_COUNT);
+    bench_blob32_nodes = malloc(sizeof(*bench_blob32_nodes)*KEY_COUNT);
+    bench_blob_nodes   = malloc(sizeof(*bench_blob_nodes)*KEY_COUNT);
+    bench_lookups      = malloc(sizeof(*bench_lookups)*LOOKUP_COUNT);
+    if(
+       bench_left == NULL ||
+       bench_right == NULL ||
+       bench_bytes == NULL ||
+       bench_keys == NULL ||
+       bench_blob16_nodes == NULL ||
+       bench_blob32_nodes == NULL ||
+       bench_blob_nodes == NULL ||
+       bench_lookups == NULL
+      )
+    {
+        return EXIT_FAILURE;
+    }
+
+    random_state = 88172645463325252ull;
+    for(size_t index = 0; index < (size_t)MAX_SIZE*PAIR_COUNT; index++)
+        bench_left[index] = (unsigned char)Bench_Random(&random_state);
+
+    memcpy(bench_right, bench_left, (size_t)MAX_SIZE*PAIR_COUNT);
+
+    /*
+        Every key holds the same bytes apart from its index, stored in its last four bytes
+     */
+    memset(bench_bytes, 0xA5, (size_t)KEY_SIZE*KEY_COUNT);
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        memcpy(&bench_bytes[index*KEY_SIZE+KEY_SIZE-sizeof(index)], &index, sizeof(index));
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        bench_lookups[index] = (unsigned int)(Bench_Random(&random_state)%KEY_COUNT);
+
+    for(size_t index = 0; index < sizeof(equal_sizes)/sizeof(equal_sizes[0]); index++)
+        RunEqualBenchmark(equal_sizes[index]);
+
+    printf("%u keys, %u buckets\n", KEY_COUNT, 1u<<BUCKET_SHIFT);
+
+    RunLookupBenchmark("16 byte", CONTAINER__BLOB16_SIZE);
+    RunLookupBenchmark("32 byte", CONTAINER__BLOB32_SIZE);
+    RunLookupBenchmark("48 byte", KEY_SIZE);
+
+    free(bench_lookups);
+    free(bench_blob_nodes);
+    free(bench_blob32_nodes);
+    free(bench_blob16_nodes);
+    free(bench_keys);
+    free(bench_bytes);
+    free(bench_right);
+    free(bench_left);
+
+    return EXIT_SUCCESS;
+}
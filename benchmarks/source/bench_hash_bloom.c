@@ -0,0 +1,281 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the time per lookup of Container_LookupHashNode against lookups made through a
+    bloom kept alongside the hash, as the fraction of lookups which miss grows.  The table is
+    loaded to several nodes per bucket so that each miss compares a full chain.  The filter is
+    then rebuilt after half of the nodes are removed, and its false positive rates reported
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/hashfn.h>
+#include <container/bloom.h>
+
+#include "bench.h"
+
+
+#define KEY_COUNT      (1u << 20)
+#define BUCKET_SHIFT   18
+#define LOOKUP_COUNT   (1u << 22)
+#define BITS_PER_VALUE 10
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static unsigned int         bench_compare_count;
+static struct bench_entry*  bench_entries;
+static unsigned int*        bench_lookup_keys;
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static unsigned int
+BenchValue (struct container__hash_node* restrict, void*);
+
+static void
+BuildLookupKeys (unsigned int);
+
+static void
+RunBenchmark (unsigned int, struct container__hash* restrict, struct container__bloom* restrict);
+
+static void
+ReportStats (const char*, struct container__bloom* restrict);
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    bench_compare_count++;
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static unsigned int
+BenchValue (struct container__hash_node* restrict node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(node, struct bench_entry, node);
+
+    return Container_HashUInt(entry->key);
+}
+
+static void
+BuildLookupKeys (unsigned int miss_percent)
+{
+    uint64_t random_state;
+
+    random_state = 88172645463325252ull;
+
+    /* Keys below KEY_COUNT are in the table, and keys above it are not */
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = (unsigned int)Bench_Random(&random_state)%KEY_COUNT;
+        if(Bench_Random(&random_state)%100 < miss_percent)
+            key += KEY_COUNT;
+
+        bench_lookup_keys[index] = key;
+    }
+}
+
+static void
+RunBenchmark (
+              unsigned int                      miss_percent,
+              struct container__hash* restrict  hash,
+              struct container__bloom* restrict bloom
+             )
+{
+    uint64_t     plain_ticks;
+    uint64_t     bloom_ticks;
+    unsigned int plain_compares;
+    unsigned int bloom_compares;
+    unsigned int found_count;
+
+    BuildLookupKeys(miss_percent);
+
+    bench_compare_count = 0;
+    found_count         = 0;
+    plain_ticks         = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        unsigned int                   key;
+
+        key = bench_lookup_keys[index];
+        if(Container_LookupHashNode(
+                                    Container_HashUInt(key),
+                                    &key,
+                                    hash,
+                                    &BenchLookup,
+                                    NULL,
+                                    &searched_bucket
+                                   ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    plain_ticks    = Bench_Ticks()-plain_ticks;
+    plain_compares = bench_compare_count;
+
+    bench_compare_count = 0;
+    bloom_ticks         = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        unsigned int                   key;
+
+        key = bench_lookup_keys[index];
+        if(Container_LookupBloomHashNode(
+                                         Container_HashUInt(key),
+                                         &key,
+                                         bloom,
+                                         hash,
+                                         &BenchLookup,
+                                         NULL,
+                                         &searched_bucket
+                                        ) != NULL)
+        {
+            found_count--;
+        }
+    }
+
+    bloom_ticks    = Bench_Ticks()-bloom_ticks;
+    bloom_compares = bench_compare_count;
+
+    if(found_count != 0)
+        printf("mismatched lookup results\n");
+
+    printf(
+           "%3u%% misses: hash %6.1f %s %5.2f compares, bloom %6.1f %s %5.2f compares\n",
+           miss_percent,
+           (double)plain_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           (double)plain_compares/LOOKUP_COUNT,
+           (double)bloom_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           (double)bloom_compares/LOOKUP_COUNT
+          );
+}
+
+static void
+ReportStats (const char* name, struct container__bloom* restrict bloom)
+{
+    struct container__bloom_stats stats;
+
+    Container_BloomStats(bloom, &stats);
+
+    printf(
+           "%-16s fill %4.2f, stale %4.2f, false positives estimated %6.4f, observed %6.4f\n",
+           name,
+           stats.fill_ratio,
+           stats.stale_ratio,
+           stats.estimated_false_positive_rate,
+           stats.observed_false_positive_rate
+          );
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__hash     hash;
+    struct container__bloom    bloom;
+    enum container__error_code error;
+
+    bench_entries     = malloc(sizeof(*bench_entries)*KEY_COUNT);
+    bench_lookup_keys = malloc(sizeof(*bench_lookup_keys)*LOOKUP_COUNT);
+    if(bench_entries == NULL || bench_lookup_keys == NULL)
+        return EXIT_FAILURE;
+
+    error = Container_CreateHashShift(BUCKET_SHIFT, &hash);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    error = Container_CreateBloom(KEY_COUNT, BITS_PER_VALUE, &bloom);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        bench_entries[index].key = index;
+
+        Container_AddBloomHashNode(
+                                   Container_HashUInt(index),
+                                   &bench_entries[index].node,
+                                   &bloom,
+                                   &hash
+                                  );
+    }
+
+    printf("%u nodes, %u buckets, %u bits per value\n", KEY_COUNT, 1u<<BUCKET_SHIFT, BITS_PER_VALUE);
+
+    /* The first run warms the caches and is repeated */
+    RunBenchmark(0, &hash, &bloom);
+    RunBenchmark(0, &hash, &bloom);
+    RunBenchmark(50, &hash, &bloom);
+    RunBenchmark(90, &hash, &bloom);
+    RunBenchmark(99, &hash, &bloom);
+
+    ReportStats("full filter", &bloom);
+
+    /* Remove every odd key, leaving their bits set until the filter is rebuilt */
+    for(unsigned int index = 1; index < KEY_COUNT; index += 2)
+        Container_RemoveBloomHashNode(&bench_entries[index].node, &bloom);
+
+    RunBenchmark(90, &hash, &bloom);
+    ReportStats("half removed", &bloom);
+
+    Container_RebuildHashBloom(&hash, &BenchValue, NULL, &bloom);
+
+    RunBenchmark(90, &hash, &bloom);
+    ReportStats("rebuilt", &bloom);
+
+    Container_DestroyBloom(&bloom);
+    Container_DestroyHash(&hash);
+    free(bench_lookup_keys);
+    free(bench_entries);
+
+    return EXIT_SUCCESS;
+}
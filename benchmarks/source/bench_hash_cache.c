@@ -0,0 +1,211 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the LRU and CLOCK policies of the cache container on two streams of unsigned int
+    keys.  The skewed stream draws from many more distinct keys than the cache holds, and a key
+    which misses is added in the bucket its lookup searched, reusing the element of the node
+    evicted for it.  The uniform stream draws only from keys the cache can hold, so once each
+    has been added every access is a hit.  The LRU policy relinks a node on every hit while the
+    CLOCK policy only marks it, so the cost per access and the hit rate of each are reported
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hashfn.h>
+#include <container/cache.h>
+
+#include "bench.h"
+
+
+#define KEY_RANGE    (1u << 20)
+#define CACHE_SIZE   (1u << 16)
+#define ACCESS_COUNT (1u << 23)
+
+
+struct bench_element
+{
+    unsigned int                 key;
+    struct bench_element*        next_free;
+    struct container__cache_node cache_node;
+};
+
+
+static struct bench_element* bench_elements;
+static struct bench_element* bench_free_elements;
+static unsigned int*         bench_skewed_keys;
+static unsigned int*         bench_uniform_keys;
+
+
+static enum container__cache_cmp_result
+BenchLookup (void*, struct container__cache_node* restrict, void*);
+
+static void
+BenchEvict (struct container__cache_node* restrict, void*);
+
+static void
+RunCacheBenchmark (enum container__cache_policy, const char*, unsigned int*, const char*);
+
+
+static enum container__cache_cmp_result
+BenchLookup (void* lookup_value, struct container__cache_node* restrict node, void* user_data)
+{
+    struct bench_element* element;
+
+    element = CONTAINER__CONTAINER_OF(node, struct bench_element, cache_node);
+    if(element->key != *(unsigned int*)lookup_value)
+        return container__cache_node_not_equal;
+
+    return container__cache_node_equal;
+}
+
+static void
+BenchEvict (struct container__cache_node* restrict node, void* user_data)
+{
+    struct bench_element* element;
+
+    element = CONTAINER__CONTAINER_OF(node, struct bench_element, cache_node);
+
+    element->next_free  = bench_free_elements;
+    bench_free_elements = element;
+}
+
+static void
+RunCacheBenchmark (
+                   enum container__cache_policy policy,
+                   const char*                  policy_name,
+                   unsigned int*                keys,
+                   const char*                  keys_name
+                  )
+{
+    struct container__cache cache;
+    uint64_t                ticks;
+
+    if(
+       Container_CreateCache(
+                             CACHE_SIZE,
+                             policy,
+                             CACHE_SIZE,
+                             0,
+                             &BenchEvict,
+                             NULL,
+                             &cache
+                            ) != container__error_none
+      )
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    /*
+        One spare element is needed, as the node evicted for a missing key is only returned
+        while the new node is being added
+     */
+    bench_free_elements = NULL;
+    for(unsigned int index = 0; index < CACHE_SIZE+1; index++)
+    {
+        bench_elements[index].next_free = bench_free_elements;
+        bench_free_elements             = &bench_elements[index];
+    }
+
+    ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < ACCESS_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        struct container__cache_node*  found_node;
+        struct bench_element*          element;
+        unsigned int                   key;
+
+        key        = keys[index];
+        found_node = Container_LookupCacheNode(
+                                               Container_HashUInt(key),
+                                               &key,
+                                               &cache,
+                                               &BenchLookup,
+                                               NULL,
+                                               &searched_bucket
+                                              );
+        if(found_node != NULL)
+            continue;
+
+        element             = bench_free_elements;
+        bench_free_elements = element->next_free;
+        element->key        = key;
+
+        Container_InsCacheNode(1, &element->cache_node, searched_bucket, &cache);
+    }
+
+    ticks = Bench_Ticks()-ticks;
+
+    printf(
+           "%-7s keys, %-5s %6.1f %s per access, %5.1f%% hits, %llu evictions\n",
+           keys_name,
+           policy_name,
+           (double)ticks/ACCESS_COUNT,
+           BENCH__TICK_UNIT,
+           100.0*(double)cache.hit_count/ACCESS_COUNT,
+           cache.eviction_count
+          );
+
+    Container_DestroyCache(&cache);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    uint64_t random_state;
+
+    bench_elements     = malloc(sizeof(*bench_elements)*(CACHE_SIZE+1));
+    bench_skewed_keys  = malloc(sizeof(*bench_skewed_keys)*ACCESS_COUNT);
+    bench_uniform_keys = malloc(sizeof(*bench_uniform_keys)*ACCESS_COUNT);
+    if(bench_elements == NULL || bench_skewed_keys == NULL || bench_uniform_keys == NULL)
+        return EXIT_FAILURE;
+
+    random_state = 88172645463325252ull;
+
+    /*
+        Cubing a uniform value skews the keys towards the low end of the range, so that a
+        small set of keys is hot while most are seldom seen
+     */
+    for(unsigned int index = 0; index < ACCESS_COUNT; index++)
+    {
+        double uniform;
+
+        uniform                  = (double)(Bench_Random(&random_state)%KEY_RANGE)/KEY_RANGE;
+        bench_skewed_keys[index] = (unsigned int)(uniform*uniform*uniform*KEY_RANGE);
+
+        bench_uniform_keys[index] = (unsigned int)(Bench_Random(&random_state)%CACHE_SIZE);
+    }
+
+    RunCacheBenchmark(container__cache_lru, "LRU", bench_skewed_keys, "skewed");
+    RunCacheBenchmark(container__cache_clock, "CLOCK", bench_skewed_keys, "skewed");
+    RunCacheBenchmark(container__cache_lru, "LRU", bench_uniform_keys, "uniform");
+    RunCacheBenchmark(container__cache_clock, "CLOCK", bench_uniform_keys, "uniform");
+
+    free(bench_uniform_keys);
+    free(bench_skewed_keys);
+    free(bench_elements);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares lookups of unsigned int keys in a hash of uint nodes, using the generated
+    lookups, against a dense uint hash, which keeps the keys in its slots.  Both hold the same
+    keys, with as many buckets as keys, and the nodes are shuffled in memory so that reading a
+    node is a cache miss, as it is in a long-lived table.  Half of the lookups miss.  Tables
+    from one which fits in the cache to one several times larger than it are measured
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/stdhash.h>
+#include <container/densehash.h>
+
+#include "bench.h"
+
+
+#define MIN_KEY_COUNT (1u << 14)
+#define MAX_KEY_COUNT (1u << 20)
+#define LOOKUP_COUNT  (1u << 22)
+
+
+static struct container__uint_hash_node*       bench_hash_nodes;
+static struct container__dense_uint_hash_node* bench_dense_nodes;
+static unsigned int*                           bench_order;
+static unsigned int*                           bench_lookups;
+
+
+static void
+BuildKeys (unsigned int, uint64_t*);
+
+static void
+RunHashBenchmark (unsigned int);
+
+static void
+RunDenseBenchmark (unsigned int);
+
+
+static void
+BuildKeys (unsigned int key_count, uint64_t* random_state)
+{
+    for(unsigned int index = 0; index < key_count; index++)
+        bench_order[index] = index;
+
+    for(unsigned int index = key_count-1; index > 0; index--)
+    {
+        unsigned int swap_index;
+        unsigned int swap_value;
+
+        swap_index = (unsigned int)(Bench_Random(random_state)%(index+1));
+        swap_value = bench_order[index];
+
+        bench_order[index]      = bench_order[swap_index];
+        bench_order[swap_index] = swap_value;
+    }
+
+    /*
+        Even keys are in the tables and odd keys are not
+     */
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        bench_lookups[index] = (unsigned int)(Bench_Random(random_state)%(key_count*2));
+}
+
+static void
+RunHashBenchmark (unsigned int key_count)
+{
+    struct container__hash hash;
+    uint64_t               ticks;
+    unsigned int           found_count;
+
+    if(Container_CreateHash(key_count, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < key_count; index++)
+        Container_AddUIntHashKey(index*2, &bench_hash_nodes[bench_order[index]], &hash);
+
+    found_count = 0;
+    ticks       = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+
+        if(Container_LookupUIntHashKey(bench_lookups[index], &hash, &searched_bucket) != NULL)
+            found_count++;
+    }
+
+    ticks = Bench_Ticks()-ticks;
+
+    printf(
+           "%8u keys, uint hash nodes  %6.1f %s per lookup, %u found\n",
+           key_count,
+           (double)ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           found_count
+          );
+
+    Container_DestroyHash(&hash);
+}
+
+static void
+RunDenseBenchmark (unsigned int key_count)
+{
+    struct container__dense_uint_hash dense_hash;
+    uint64_t                          ticks;
+    unsigned int                      found_count;
+
+    if(Container_CreateDenseUIntHash(key_count, &dense_hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < key_count; index++)
+    {
+        if(Container_AddDenseUIntHash(
+                                      index*2,
+                                      &bench_dense_nodes[bench_order[index]],
+                                      &dense_hash
+                                     ) != container__error_none)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    found_count = 0;
+    ticks       = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__dense_hash_probe probe;
+
+        if(Container_LookupDenseUIntHash(bench_lookups[index], &dense_hash, &probe) != NULL)
+            found_count++;
+    }
+
+    ticks = Bench_Ticks()-ticks;
+
+    printf(
+           "%8u keys, dense uint hash  %6.1f %s per lookup, %u found, %u slots\n",
+           key_count,
+           (double)ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           found_count,
+           dense_hash.slot_mask+1
+          );
+
+    Container_DestroyDenseUIntHash(&dense_hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    uint64_t random_state;
+
+    bench_hash_nodes  = malloc(sizeof(*bench_hash_nodes)*MAX_KEY_COUNT);
+    bench_dense_nodes = malloc(sizeof(*bench_dense_nodes)*MAX_KEY_COUNT);
+    bench_order       = malloc(sizeof(*bench_order)*MAX_KEY_COUNT);
+    bench_lookups     = malloc(sizeof(*bench_lookups)*LOOKUP_COUNT);
+    if(
+       bench_hash_nodes == NULL ||
+       bench_dense_nodes == NULL ||
+       bench_order == NULL ||
+       bench_lookups == NULL
+      )
+    {
+        return EXIT_FAILURE;
+    }
+
+    random_state = 88172645463325252ull;
+
+    for(unsigned int key_count = MIN_KEY_COUNT; key_count <= MAX_KEY_COUNT; key_count <<= 3)
+    {
+        BuildKeys(key_count, &random_state);
+
+        RunHashBenchmark(key_count);
+        RunDenseBenchmark(key_count);
+    }
+
+    free(bench_lookups);
+    free(bench_order);
+    free(bench_dense_nodes);
+    free(bench_hash_nodes);
+
+    return EXIT_SUCCESS;
+}
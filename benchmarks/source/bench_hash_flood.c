@@ -0,0 +1,183 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Measures lookups when every key has been chosen to land in the same bucket of a hash with
+    a fixed bucket selection.  The keys are multiples of the bucket count and hash to
+    themselves, as they would with an identity hash of integer ids.  The same keys are then
+    looked up in a seeded thash, and in a thash with a single bucket, where every node must
+    share one bucket and only the tree bounds the lookup cost
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/thash.h>
+
+#include "bench.h"
+
+
+#define BUCKET_COUNT 4096
+#define KEY_COUNT    (1u << 14)
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node  hash_node;
+    struct container__thash_node thash_node;
+};
+
+
+static enum container__hash_cmp_result
+BenchHashLookup (void*, struct container__hash_node* restrict, void*);
+
+static enum container__hash_cmp_result
+BenchTHashLookup (void*, struct container__thash_node* restrict, void*);
+
+static void
+RunTHashBenchmark (const char*, unsigned int, struct bench_entry* restrict);
+
+
+static enum container__hash_cmp_result
+BenchHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, hash_node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static enum container__hash_cmp_result
+BenchTHashLookup (
+                  void*                                  lookup_key,
+                  struct container__thash_node* restrict cmp_node,
+                  void*                                  user_data
+                 )
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, thash_node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+RunTHashBenchmark (
+                   const char*                  name,
+                   unsigned int                 bucket_count,
+                   struct bench_entry* restrict entries
+                  )
+{
+    struct container__thash thash;
+    uint64_t                start_ticks;
+    uint64_t                total_ticks;
+
+    if(Container_CreateTHash(bucket_count, &thash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        Container_AddTHashNode(entries[index].key, &entries[index].thash_node, &thash);
+
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = entries[index].key;
+        if(Container_LookupTHashNode(key, &key, &thash, &BenchTHashLookup, NULL) == NULL)
+            exit(EXIT_FAILURE);
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf("%-20s %10.1f %s/lookup\n", name, (double)total_ticks/KEY_COUNT, BENCH__TICK_UNIT);
+
+    Container_DestroyTHash(&thash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__hash         hash;
+    struct container__hash_bucket* searched_bucket;
+    struct bench_entry*            entries;
+    uint64_t                       start_ticks;
+    uint64_t                       total_ticks;
+
+    entries = malloc(sizeof(*entries)*KEY_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        entries[index].key = index*BUCKET_COUNT;
+
+    if(Container_CreateHash(BUCKET_COUNT, &hash) != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        Container_AddHashNode(entries[index].key, &entries[index].hash_node, &hash);
+
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = entries[index].key;
+        if(Container_LookupHashNode(
+                                    key,
+                                    &key,
+                                    &hash,
+                                    &BenchHashLookup,
+                                    NULL,
+                                    &searched_bucket
+                                   ) == NULL)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf("%-20s %10.1f %s/lookup\n", "hash", (double)total_ticks/KEY_COUNT, BENCH__TICK_UNIT);
+
+    Container_DestroyHash(&hash);
+
+    RunTHashBenchmark("seeded thash", BUCKET_COUNT, entries);
+    RunTHashBenchmark("single bucket thash", 1, entries);
+
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
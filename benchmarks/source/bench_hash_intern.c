@@ -0,0 +1,224 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares interning a stream of repeated identifiers with the intern container against a
+    string hash of separately allocated nodes and copies, which looks each identifier up and
+    then adds it with a second probe should it be missing.  Both are timed from empty, so the
+    first sight of each identifier, the copies and the hash growth of the intern container are
+    all included
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/stdhash.h>
+#include <container/intern.h>
+
+#include "bench.h"
+
+
+#define IDENT_COUNT  (1u << 18)
+#define TOKEN_COUNT  (1u << 22)
+#define BUCKET_COUNT (1u << 10)
+#define IDENT_SIZE   32
+
+
+static char*         bench_idents;
+static size_t*       bench_lengths;
+static unsigned int* bench_tokens;
+
+
+static void
+RunMallocBenchmark (void);
+
+static void
+RunInternBenchmark (void);
+
+
+static void
+RunMallocBenchmark (void)
+{
+    struct container__hash hash;
+    uint64_t               ticks;
+    unsigned int           distinct_count;
+
+    /*
+        The string hash isn't grown, so it starts with as many buckets as the intern
+        container ends with
+     */
+    if(Container_CreateHash(IDENT_COUNT/CONTAINER__INTERN_MAX_LOAD, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    distinct_count = 0;
+    ticks          = Bench_Ticks();
+
+    for(unsigned int index = 0; index < TOKEN_COUNT; index++)
+    {
+        struct container__string_hash_node* node;
+        struct container__hash_bucket*      searched_bucket;
+        char*                               ident;
+
+        ident = &bench_idents[bench_tokens[index]*IDENT_SIZE];
+        node  = Container_LookupStringHashKey(ident, &hash, &searched_bucket);
+        if(node != NULL)
+            continue;
+
+        node = malloc(sizeof(*node));
+        if(node == NULL)
+            exit(EXIT_FAILURE);
+
+        node->value = malloc(bench_lengths[bench_tokens[index]]+1);
+        if(node->value == NULL)
+            exit(EXIT_FAILURE);
+
+        memcpy(node->value, ident, bench_lengths[bench_tokens[index]]+1);
+
+        Container_AddStringHashKey(node->value, node, &hash);
+
+        distinct_count++;
+    }
+
+    ticks = Bench_Ticks()-ticks;
+
+    printf(
+           "malloc'd string nodes %6.1f %s per token, %u distinct\n",
+           (double)ticks/TOKEN_COUNT,
+           BENCH__TICK_UNIT,
+           distinct_count
+          );
+
+    for(unsigned int index = 0; index < hash.bucket_count; index++)
+    {
+        struct container__hash_bucket_scan scan;
+        struct container__hash_bucket*     bucket;
+
+        bucket = &hash.buckets[index];
+
+        Container_StartHashBucketScan(bucket, &scan);
+        while(Container_HashBucketScanState(&scan) != container__hash_bucket_scan_finished)
+        {
+            struct container__string_hash_node* node;
+
+            node = CONTAINER__CONTAINER_OF(
+                                           scan.current_node,
+                                           struct container__string_hash_node,
+                                           node
+                                          );
+
+            Container_ResumeHashBucketScan(bucket, &scan);
+
+            free(node->value);
+            free(node);
+        }
+    }
+
+    Container_DestroyHash(&hash);
+}
+
+static void
+RunInternBenchmark (void)
+{
+    struct container__intern intern;
+    uint64_t                 ticks;
+
+    if(Container_CreateIntern(BUCKET_COUNT, &intern) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < TOKEN_COUNT; index++)
+    {
+        const char* handle;
+
+        if(Container_InternString(
+                                  &bench_idents[bench_tokens[index]*IDENT_SIZE],
+                                  bench_lengths[bench_tokens[index]],
+                                  &handle,
+                                  &intern
+                                 ) != container__error_none)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    ticks = Bench_Ticks()-ticks;
+
+    printf(
+           "intern                %6.1f %s per token, %lu distinct in %lu chunks\n",
+           (double)ticks/TOKEN_COUNT,
+           BENCH__TICK_UNIT,
+           (unsigned long)intern.string_count,
+           (unsigned long)intern.chunk_count
+          );
+
+    Container_DestroyIntern(&intern);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    uint64_t random_state;
+
+    bench_idents  = malloc((size_t)IDENT_SIZE*IDENT_COUNT);
+    bench_lengths = malloc(sizeof(*bench_lengths)*IDENT_COUNT);
+    bench_tokens  = malloc(sizeof(*bench_tokens)*TOKEN_COUNT);
+    if(bench_idents == NULL || bench_lengths == NULL || bench_tokens == NULL)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < IDENT_COUNT; index++)
+    {
+        char* ident;
+
+        ident = &bench_idents[index*IDENT_SIZE];
+
+        snprintf(ident, IDENT_SIZE, "ident_%u", index);
+        bench_lengths[index] = strlen(ident);
+    }
+
+    /*
+        Squaring a uniform value skews the tokens towards the low identifiers, so that most
+        tokens repeat an identifier already seen
+     */
+    random_state = 88172645463325252ull;
+    for(unsigned int index = 0; index < TOKEN_COUNT; index++)
+    {
+        double uniform;
+
+        uniform             = (double)(Bench_Random(&random_state)>>11)/(double)(1ull<<53);
+        bench_tokens[index] = (unsigned int)(uniform*uniform*IDENT_COUNT);
+    }
+
+    printf("%u tokens of %u identifiers\n", TOKEN_COUNT, IDENT_COUNT);
+
+    RunMallocBenchmark();
+    RunInternBenchmark();
+
+    free(bench_tokens);
+    free(bench_lengths);
+    free(bench_idents);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares folding several per-thread hashes into a global one by removing and re-adding
+    every node, by Container_MergeHash with a matching bucket count, which splices buckets,
+    and by Container_MergeHash with a different bucket count, which rehashes each node using
+    its cached hash value
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define BUCKET_SHIFT     14
+#define TABLE_COUNT      8
+#define TABLE_NODE_COUNT (1u << 14)
+#define ROUND_COUNT      16
+
+
+enum bench_mode
+{
+    bench_mode_readd,
+    bench_mode_splice,
+    bench_mode_rehash
+};
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__cached_hash_node node;
+};
+
+
+static void
+RunBenchmark (const char*, enum bench_mode, struct bench_entry* restrict);
+
+
+static void
+RunBenchmark (const char* name, enum bench_mode mode, struct bench_entry* restrict entries)
+{
+    struct container__hash tables[TABLE_COUNT];
+    struct container__hash global;
+    unsigned int           global_shift;
+    uint64_t               total_ticks;
+
+    global_shift = BUCKET_SHIFT;
+    if(mode == bench_mode_rehash)
+        global_shift++;
+
+    if(Container_CreateHashShift(global_shift, &global) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int table = 0; table < TABLE_COUNT; table++)
+    {
+        if(Container_CreateHashShift(BUCKET_SHIFT, &tables[table]) != container__error_none)
+            exit(EXIT_FAILURE);
+    }
+
+    total_ticks = 0;
+
+    for(unsigned int round = 0; round < ROUND_COUNT; round++)
+    {
+        uint64_t start_ticks;
+
+        for(unsigned int table = 0; table < TABLE_COUNT; table++)
+        {
+            for(unsigned int index = 0; index < TABLE_NODE_COUNT; index++)
+            {
+                struct bench_entry* entry;
+
+                entry = &entries[table*TABLE_NODE_COUNT+index];
+
+                Container_AddCachedHashNode(entry->key, &entry->node, &tables[table]);
+            }
+        }
+
+        start_ticks = Bench_Ticks();
+
+        for(unsigned int table = 0; table < TABLE_COUNT; table++)
+        {
+            if(mode != bench_mode_readd)
+            {
+                Container_MergeHash(&tables[table], &global, &Container_CachedHashValue, NULL);
+
+                continue;
+            }
+
+            for(unsigned int index = 0; index < TABLE_NODE_COUNT; index++)
+            {
+                struct bench_entry* entry;
+
+                entry = &entries[table*TABLE_NODE_COUNT+index];
+
+                Container_RemoveHashNode(&entry->node.node);
+                Container_AddCachedHashNode(entry->key, &entry->node, &global);
+            }
+        }
+
+        total_ticks += Bench_Ticks()-start_ticks;
+
+        Container_ResetHash(&global);
+    }
+
+    printf(
+           "%-16s %14.0f %s/merge\n",
+           name,
+           (double)total_ticks/ROUND_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    for(unsigned int table = 0; table < TABLE_COUNT; table++)
+        Container_DestroyHash(&tables[table]);
+
+    Container_DestroyHash(&global);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct bench_entry* entries;
+    uint64_t            random_state;
+
+    entries = malloc(sizeof(*entries)*TABLE_COUNT*TABLE_NODE_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < TABLE_COUNT*TABLE_NODE_COUNT; index++)
+        entries[index].key = (unsigned int)Bench_Random(&random_state);
+
+    RunBenchmark("remove and add", bench_mode_readd, entries);
+    RunBenchmark("splice", bench_mode_splice, entries);
+    RunBenchmark("cached rehash", bench_mode_rehash, entries);
+
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,314 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Measures total lookup throughput as reader threads are added, for a hash guarded by a
+    single mutex, an shash with striped mutexes, and lock-free rhash lookups within epoch
+    critical sections.  The thread counts run in powers of two up to the number of online
+    processors, or up to the count given as the first argument
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/shash.h>
+#include <container/epoch.h>
+#include <container/rhash.h>
+
+#include "bench.h"
+
+
+#define TABLE_SHIFT  16
+#define STRIPE_COUNT 64
+#define RUN_SECONDS  0.5
+
+
+enum bench_mode
+{
+    bench_mode_mutex,
+    bench_mode_striped,
+    bench_mode_epoch
+};
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+struct bench_stripe
+{
+    pthread_mutex_t mutex;
+} __attribute__((aligned(64)));
+
+struct bench_reader
+{
+    unsigned int    reader_index;
+    enum bench_mode mode;
+    uint64_t        lookup_count;
+} __attribute__((aligned(64)));
+
+
+static struct container__shash bench_shash;
+static struct container__epoch bench_epoch;
+static struct bench_stripe     bench_stripes[STRIPE_COUNT];
+static pthread_mutex_t         bench_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int                     bench_done;
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+BenchLock (void*);
+
+static void
+BenchUnlock (void*);
+
+static void
+BenchReclaim (struct container__epoch_node* restrict, void*);
+
+static void*
+BenchReader (void*);
+
+static void
+RunBenchmark (const char*, enum bench_mode, unsigned int);
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+BenchLock (void* stripe)
+{
+    pthread_mutex_lock(&((struct bench_stripe*)stripe)->mutex);
+}
+
+static void
+BenchUnlock (void* stripe)
+{
+    pthread_mutex_unlock(&((struct bench_stripe*)stripe)->mutex);
+}
+
+static void
+BenchReclaim (struct container__epoch_node* restrict node, void* user_data)
+{
+}
+
+static void*
+BenchReader (void* argument)
+{
+    struct bench_reader* reader;
+    uint64_t             random_state;
+    uint64_t             lookup_count;
+
+    reader       = argument;
+    random_state = 88172645463325252ull+reader->reader_index;
+    lookup_count = 0;
+
+    while(!__atomic_load_n(&bench_done, __ATOMIC_RELAXED))
+    {
+        for(unsigned int index = 0; index < 256; index++)
+        {
+            struct container__hash_bucket* searched_bucket;
+            struct container__hash_node*   found_node;
+            unsigned int                   key;
+
+            key = (unsigned int)Bench_Random(&random_state)&((1u<<TABLE_SHIFT)-1);
+
+            switch(reader->mode)
+            {
+            case bench_mode_mutex:
+                pthread_mutex_lock(&bench_mutex);
+                found_node = Container_LookupHashNode(
+                                                      key,
+                                                      &key,
+                                                      &bench_shash.hash,
+                                                      &BenchLookup,
+                                                      NULL,
+                                                      &searched_bucket
+                                                     );
+                pthread_mutex_unlock(&bench_mutex);
+                break;
+
+            case bench_mode_striped:
+                found_node = Container_LookupSHashNode(
+                                                       key,
+                                                       &key,
+                                                       &bench_shash,
+                                                       &BenchLookup,
+                                                       NULL,
+                                                       &searched_bucket
+                                                      );
+                Container_UnlockSHashBucket(searched_bucket, &bench_shash);
+                break;
+
+            default:
+                Container_EnterEpoch(reader->reader_index, &bench_epoch);
+                found_node = Container_LookupRHashNode(
+                                                       key,
+                                                       &key,
+                                                       &bench_shash.hash,
+                                                       &BenchLookup,
+                                                       NULL
+                                                      );
+                Container_ExitEpoch(reader->reader_index, &bench_epoch);
+                break;
+            }
+
+            if(found_node != NULL)
+                lookup_count++;
+        }
+    }
+
+    reader->lookup_count = lookup_count;
+
+    return NULL;
+}
+
+static void
+RunBenchmark (const char* name, enum bench_mode mode, unsigned int thread_count)
+{
+    struct bench_reader* readers;
+    pthread_t*           threads;
+    uint64_t             lookup_count;
+    double               start_seconds;
+    double               total_seconds;
+
+    readers = aligned_alloc(64, sizeof(*readers)*thread_count);
+    threads = malloc(sizeof(*threads)*thread_count);
+    if(readers == NULL || threads == NULL)
+        exit(EXIT_FAILURE);
+
+    bench_done    = 0;
+    start_seconds = Bench_Seconds();
+
+    for(unsigned int index = 0; index < thread_count; index++)
+    {
+        readers[index].reader_index = index;
+        readers[index].mode         = mode;
+
+        pthread_create(&threads[index], NULL, &BenchReader, &readers[index]);
+    }
+
+    while(Bench_Seconds()-start_seconds < RUN_SECONDS)
+        usleep(1000);
+
+    __atomic_store_n(&bench_done, 1, __ATOMIC_RELAXED);
+
+    lookup_count = 0;
+    for(unsigned int index = 0; index < thread_count; index++)
+    {
+        pthread_join(threads[index], NULL);
+
+        lookup_count += readers[index].lookup_count;
+    }
+
+    total_seconds = Bench_Seconds()-start_seconds;
+
+    printf(
+           "%3u readers, %-16s %8.2f million lookups/s\n",
+           thread_count,
+           name,
+           (double)lookup_count/total_seconds*1e-6
+          );
+
+    free(threads);
+    free(readers);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct bench_entry*        entries;
+    enum container__error_code error;
+    unsigned int               max_threads;
+    unsigned int               node_count;
+
+    if(argument_count > 1)
+        max_threads = (unsigned int)atoi(arguments[1]);
+    else
+        max_threads = (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(max_threads == 0)
+        max_threads = 1;
+
+    for(unsigned int index = 0; index < STRIPE_COUNT; index++)
+        pthread_mutex_init(&bench_stripes[index].mutex, NULL);
+
+    error = Container_CreateSHashShift(
+                                       TABLE_SHIFT,
+                                       STRIPE_COUNT,
+                                       sizeof(bench_stripes[0]),
+                                       bench_stripes,
+                                       &BenchLock,
+                                       &BenchUnlock,
+                                       &bench_shash
+                                      );
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    error = Container_CreateEpoch(max_threads, &BenchReclaim, NULL, &bench_epoch);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    node_count = 1u<<TABLE_SHIFT;
+    entries    = malloc(sizeof(*entries)*node_count);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < node_count; index++)
+    {
+        entries[index].key = index;
+
+        Container_AddRHashNode(index, &entries[index].node, &bench_shash.hash);
+    }
+
+    for(unsigned int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+    {
+        RunBenchmark("single mutex", bench_mode_mutex, thread_count);
+        RunBenchmark("striped mutexes", bench_mode_striped, thread_count);
+        RunBenchmark("epoch, no locks", bench_mode_epoch, thread_count);
+    }
+
+    Container_DestroyEpoch(&bench_epoch);
+    Container_DestroySHash(&bench_shash);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Measures the time taken to create and then reset a large hash as the work is split across
+    more threads, using a run function which starts one thread per part.  The thread counts run
+    in powers of two up to the number of online processors, or up to the count given as the
+    first argument.  The bucket count may be given as a base 2 logarithm in the second argument
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define DEFAULT_TABLE_SHIFT 24
+#define MAX_THREADS         256
+
+
+struct bench_part
+{
+    unsigned int              part_index;
+    container__hash_part_type part;
+    void*                     part_data;
+};
+
+
+static void*
+BenchPartThread (void*);
+
+static void
+BenchRunParts (unsigned int, container__hash_part_type, void*, void*);
+
+
+static void*
+BenchPartThread (void* argument)
+{
+    struct bench_part* part;
+
+    part = argument;
+
+    (*part->part)(part->part_index, part->part_data);
+
+    return NULL;
+}
+
+static void
+BenchRunParts (
+               unsigned int              part_count,
+               container__hash_part_type part,
+               void*                     part_data,
+               void*                     user_data
+              )
+{
+    struct bench_part parts[MAX_THREADS];
+    pthread_t         threads[MAX_THREADS];
+
+    for(unsigned int index = 1; index < part_count; index++)
+    {
+        parts[index].part_index = index;
+        parts[index].part       = part;
+        parts[index].part_data  = part_data;
+
+        pthread_create(&threads[index], NULL, &BenchPartThread, &parts[index]);
+    }
+
+    (*part)(0, part_data);
+
+    for(unsigned int index = 1; index < part_count; index++)
+        pthread_join(threads[index], NULL);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__hash          hash;
+    struct container__hash_parallel parallel;
+    enum container__error_code      error;
+    unsigned int                    max_threads;
+    unsigned int                    table_shift;
+
+    if(argument_count > 1)
+        max_threads = (unsigned int)atoi(arguments[1]);
+    else
+        max_threads = (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(max_threads == 0)
+        max_threads = 1;
+    if(max_threads > MAX_THREADS)
+        max_threads = MAX_THREADS;
+
+    table_shift = argument_count > 2 ? (unsigned int)atoi(arguments[2]) : DEFAULT_TABLE_SHIFT;
+
+    printf("%u buckets, %lu MB\n",
+           1u<<table_shift,
+           (unsigned long)((sizeof(struct container__hash_bucket)<<table_shift)>>20));
+
+    parallel.run_parts = &BenchRunParts;
+    parallel.user_data = NULL;
+
+    for(unsigned int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+    {
+        double create_seconds;
+        double reset_seconds;
+
+        parallel.part_count = thread_count;
+
+        create_seconds = Bench_Seconds();
+        error          = Container_CreateHashShiftParallel(
+                                                           table_shift,
+                                                           container__hash_alloc_default,
+                                                           NULL,
+                                                           &parallel,
+                                                           &hash
+                                                          );
+        if(error != container__error_none)
+            return EXIT_FAILURE;
+
+        create_seconds = Bench_Seconds()-create_seconds;
+
+        /* Reset once to fault in every page, then time a reset of memory already mapped */
+        Container_ResetHashParallel(&parallel, &hash);
+
+        reset_seconds = Bench_Seconds();
+        Container_ResetHashParallel(&parallel, &hash);
+        reset_seconds = Bench_Seconds()-reset_seconds;
+
+        printf(
+               "%3u threads, create %8.2f ms, reset %8.2f ms\n",
+               thread_count,
+               create_seconds*1e3,
+               reset_seconds*1e3
+              );
+
+        Container_DestroyHash(&hash);
+    }
+
+    return EXIT_SUCCESS;
+}
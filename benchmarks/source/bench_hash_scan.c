@@ -0,0 +1,135 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the time taken to scan every node of a sparsely populated hash with and without
+    an occupancy bitmap.  Each pass visits the same nodes, so the difference is the cost of
+    stepping over empty buckets
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define BUCKET_SHIFT 20
+#define PASS_COUNT   16
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static void
+RunBenchmark (const char*, unsigned int, int, struct bench_entry* restrict);
+
+
+static void
+RunBenchmark (
+              const char*                  name,
+              unsigned int                 entry_count,
+              int                          use_occupancy,
+              struct bench_entry* restrict entries
+             )
+{
+    struct container__hash hash;
+    unsigned long          visit_count;
+    uint64_t               start_ticks;
+    uint64_t               total_ticks;
+
+    if(Container_CreateHashShift(BUCKET_SHIFT, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    if(use_occupancy && Container_CreateHashOccupancy(&hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < entry_count; index++)
+        Container_AddHashNode(entries[index].key, &entries[index].node, &hash);
+
+    visit_count = 0;
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int pass = 0; pass < PASS_COUNT; pass++)
+    {
+        struct container__hash_scan scan;
+
+        for(
+            Container_StartHashScan(&hash, &scan);
+            Container_HashScanState(&scan) != container__hash_scan_finished;
+            Container_ResumeHashScan(&hash, &scan)
+           )
+        {
+            visit_count++;
+        }
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    if(visit_count != (unsigned long)entry_count*PASS_COUNT)
+        exit(EXIT_FAILURE);
+
+    printf(
+           "%8u nodes %-12s %12.0f %s/scan\n",
+           entry_count,
+           name,
+           (double)total_ticks/PASS_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    Container_DestroyHashOccupancy(&hash);
+    Container_DestroyHash(&hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    static const unsigned int entry_counts[] = {1u << 8, 1u << 12, 1u << 16, 1u << 20};
+
+    struct bench_entry* entries;
+    uint64_t            random_state;
+
+    entries = malloc(sizeof(*entries)*(1u << 20));
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < 1u << 20; index++)
+        entries[index].key = (unsigned int)Bench_Random(&random_state);
+
+    for(unsigned int index = 0; index < sizeof(entry_counts)/sizeof(entry_counts[0]); index++)
+    {
+        RunBenchmark("every bucket", entry_counts[index], 0, entries);
+        RunBenchmark("occupancy", entry_counts[index], 1, entries);
+    }
+
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the per-lookup cost of selecting hash buckets by modulo against the power of two
+    shift mode, for a table which fits in cache and for one which does not.  Random keys are
+    used to compare bucket selection cost, then keys which are multiples of 64 are used to
+    show how the shift mode spreads a low entropy pattern which defeats a power of two modulo
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define SMALL_SHIFT  12
+#define LARGE_SHIFT  20
+#define LOOKUP_COUNT (1u << 22)
+#define KEY_SPACING  64u
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+RunBenchmark (
+              const char*,
+              unsigned int,
+              struct container__hash* restrict,
+              struct bench_entry* restrict
+             );
+
+static enum container__error_code
+RunBenchmarks (unsigned int, unsigned int, unsigned int);
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+RunBenchmark (
+              const char*                      name,
+              unsigned int                     node_count,
+              struct container__hash* restrict hash,
+              struct bench_entry* restrict     entries
+             )
+{
+    struct container__hash_bucket* searched_bucket;
+    uint64_t                       random_state;
+    uint64_t                       start_ticks;
+    uint64_t                       total_ticks;
+    unsigned int                   found_count;
+
+    for(unsigned int index = 0; index < node_count; index++)
+        Container_AddHashNode(entries[index].key, &entries[index].node, hash);
+
+    random_state = 88172645463325252ull;
+    found_count  = 0;
+    start_ticks  = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_node* found_node;
+        unsigned int                 key;
+
+        key        = entries[Bench_Random(&random_state)%node_count].key;
+        found_node = Container_LookupHashNode(
+                                              key,
+                                              &key,
+                                              hash,
+                                              &BenchLookup,
+                                              NULL,
+                                              &searched_bucket
+                                             );
+        if(found_node != NULL)
+            found_count++;
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf(
+           "%8u nodes, %-34s %10.1f %s/lookup (%u found)\n",
+           node_count,
+           name,
+           (double)total_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           found_count
+          );
+}
+
+
+static enum container__error_code
+RunBenchmarks (unsigned int shift, unsigned int prime_count, unsigned int spacing)
+{
+    struct bench_entry*        entries;
+    struct container__hash     hash;
+    enum container__error_code error;
+    uint64_t                   random_state;
+    unsigned int               node_count;
+
+    node_count = 1u<<shift;
+    entries    = malloc(sizeof(*entries)*node_count);
+    if(entries == NULL)
+        return container__error_memory_alloc;
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < node_count; index++)
+    {
+        if(spacing == 0)
+            entries[index].key = (unsigned int)Bench_Random(&random_state);
+        else
+            entries[index].key = index*spacing;
+    }
+
+    if(spacing == 0)
+        error = Container_CreateHash(prime_count, &hash);
+    else
+        error = Container_CreateHash(node_count, &hash);
+
+    if(error != container__error_none)
+        goto cleanup;
+
+    if(spacing == 0)
+        RunBenchmark("random keys, modulo prime", node_count, &hash, entries);
+    else
+        RunBenchmark("spaced keys, modulo power of two", node_count, &hash, entries);
+
+    Container_DestroyHash(&hash);
+
+    error = Container_CreateHashShift(shift, &hash);
+    if(error != container__error_none)
+        goto cleanup;
+
+    if(spacing == 0)
+        RunBenchmark("random keys, shift", node_count, &hash, entries);
+    else
+        RunBenchmark("spaced keys, shift", node_count, &hash, entries);
+
+    Container_DestroyHash(&hash);
+
+cleanup:
+    free(entries);
+
+    return error;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    if(RunBenchmarks(SMALL_SHIFT, 4093, 0) != container__error_none)
+        return EXIT_FAILURE;
+
+    if(RunBenchmarks(LARGE_SHIFT, 1048573, 0) != container__error_none)
+        return EXIT_FAILURE;
+
+    if(RunBenchmarks(SMALL_SHIFT, 0, KEY_SPACING) != container__error_none)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the time per lookup of the string, string key and inline string nodes, using
+    the generated lookups for the first two.  Keys share a long common prefix, as paths and
+    qualified names do, so a full comparison must read most of each string, and the table is
+    overloaded so that each lookup compares several nodes.  Short keys are also measured,
+    which the inline string node stores within itself
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/stdhash.h>
+
+#include "bench.h"
+
+
+#define KEY_COUNT    (1u << 18)
+#define BUCKET_SHIFT 15
+#define LOOKUP_COUNT (1u << 22)
+#define KEY_SIZE     48
+
+
+static char*                                      bench_strings;
+static struct container__string_key*              bench_keys;
+static struct container__string_hash_node*        bench_string_nodes;
+static struct container__string_key_hash_node*    bench_key_nodes;
+static struct container__inline_string_hash_node* bench_inline_nodes;
+static unsigned int*                              bench_lookups;
+
+
+static void
+BuildKeys (const char*);
+
+static void
+RunBenchmark (const char*);
+
+
+static void
+BuildKeys (const char* format)
+{
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        char* string;
+
+        string = &bench_strings[index*KEY_SIZE];
+
+        snprintf(string, KEY_SIZE, format, index);
+        Container_InitStringKey(string, strlen(string), &bench_keys[index]);
+    }
+}
+
+static void
+RunBenchmark (const char* name)
+{
+    struct container__hash hash;
+    uint64_t               string_ticks;
+    uint64_t               key_ticks;
+    uint64_t               inline_ticks;
+    unsigned int           found_count;
+
+    if(Container_CreateHashShift(BUCKET_SHIFT, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        Container_AddStringHashKey(
+                                   &bench_strings[index*KEY_SIZE],
+                                   &bench_string_nodes[index],
+                                   &hash
+                                  );
+    }
+
+    found_count  = 0;
+    string_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+
+        if(Container_LookupStringHashKey(
+                                         &bench_strings[bench_lookups[index]*KEY_SIZE],
+                                         &hash,
+                                         &searched_bucket
+                                        ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    string_ticks = Bench_Ticks()-string_ticks;
+
+    Container_ResetHash(&hash);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        Container_AddStringKeyHashKey(bench_keys[index], &bench_key_nodes[index], &hash);
+
+    key_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+
+        if(Container_LookupStringKeyHashKey(
+                                            bench_keys[bench_lookups[index]],
+                                            &hash,
+                                            &searched_bucket
+                                           ) != NULL)
+        {
+            found_count--;
+        }
+    }
+
+    key_ticks = Bench_Ticks()-key_ticks;
+
+    Container_ResetHash(&hash);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        Container_AddInlineStringHash(&bench_keys[index], &bench_inline_nodes[index], &hash);
+
+    inline_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        struct container__hash_bucket* searched_bucket;
+        struct container__string_key*  key;
+
+        key = &bench_keys[bench_lookups[index]];
+        if(Container_LookupHashNode(
+                                    key->value_hash,
+                                    key,
+                                    &hash,
+                                    &Container_InlineStringHashLookup,
+                                    NULL,
+                                    &searched_bucket
+                                   ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    inline_ticks = Bench_Ticks()-inline_ticks;
+
+    if(found_count != LOOKUP_COUNT)
+        printf("mismatched lookup results\n");
+
+    printf(
+           "%-14s string %6.1f %s, string key %6.1f %s, inline string %6.1f %s\n",
+           name,
+           (double)string_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           (double)key_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           (double)inline_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    Container_DestroyHash(&hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    uint64_t random_state;
+
+    bench_strings      = malloc((size_t)KEY_SIZE*KEY_COUNT);
+    bench_keys         = malloc(sizeof(*bench_keys)*KEY_COUNT);
+    bench_string_nodes = malloc(sizeof(*bench_string_nodes)*KEY_COUNT);
+    bench_key_nodes    = malloc(sizeof(*bench_key_nodes)*KEY_COUNT);
+    bench_inline_nodes = malloc(sizeof(*bench_inline_nodes)*KEY_COUNT);
+    bench_lookups      = malloc(sizeof(*bench_lookups)*LOOKUP_COUNT);
+    if(
+       bench_strings == NULL ||
+       bench_keys == NULL ||
+       bench_string_nodes == NULL ||
+       bench_key_nodes == NULL ||
+       bench_inline_nodes == NULL ||
+       bench_lookups == NULL
+      )
+    {
+        return EXIT_FAILURE;
+    }
+
+    random_state = 88172645463325252ull;
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        bench_lookups[index] = (unsigned int)(Bench_Random(&random_state)%KEY_COUNT);
+
+    printf("%u keys, %u buckets\n", KEY_COUNT, 1u<<BUCKET_SHIFT);
+
+    BuildKeys("/srv/data/users/session/%08u");
+    RunBenchmark("long prefixed");
+
+    BuildKeys("k%08u");
+    RunBenchmark("short");
+
+    free(bench_lookups);
+    free(bench_inline_nodes);
+    free(bench_key_nodes);
+    free(bench_string_nodes);
+    free(bench_keys);
+    free(bench_strings);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares random lookups in a hash whose buckets are spread over a few hundred megabytes,
+    allocated with malloc and with huge pages.  Each lookup touches a random bucket, so with
+    small pages nearly every lookup misses the TLB.  Data TLB misses are counted with
+    perf_event_open where the kernel allows it, and otherwise only the time is reported
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/hashfn.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bench.h"
+
+
+#define BUCKET_SHIFT 25
+#define KEY_COUNT    (1u << 22)
+#define LOOKUP_COUNT (1u << 22)
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static int
+OpenTLBCounter (void);
+
+static long long
+ReadTLBCounter (int);
+
+static void
+RunBenchmark (
+              const char*,
+              enum container__hash_alloc_type,
+              struct bench_entry* restrict,
+              const unsigned int* restrict
+             );
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+/*
+    Returns a file descriptor counting data TLB read misses of this thread, or -1
+ */
+static int
+OpenTLBCounter (void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    attr.type           = PERF_TYPE_HW_CACHE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_CACHE_DTLB|
+                          (PERF_COUNT_HW_CACHE_OP_READ<<8)|
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS<<16);
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static long long
+ReadTLBCounter (int counter)
+{
+    long long count;
+
+    if(counter < 0)
+        return -1;
+
+    if(read(counter, &count, sizeof(count)) != sizeof(count))
+        return -1;
+
+    return count;
+}
+
+static void
+RunBenchmark (
+              const char*                     name,
+              enum container__hash_alloc_type alloc_type,
+              struct bench_entry* restrict    entries,
+              const unsigned int* restrict    lookup_keys
+             )
+{
+    struct container__hash         hash;
+    struct container__hash_bucket* searched_bucket;
+    uint64_t                       start_ticks;
+    uint64_t                       total_ticks;
+    long long                      tlb_misses;
+    int                            counter;
+
+    if(Container_CreateHashShiftAlloc(BUCKET_SHIFT, alloc_type, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        Container_AddHashNode(
+                              Container_HashUInt(entries[index].key),
+                              &entries[index].node,
+                              &hash
+                             );
+    }
+
+    counter = OpenTLBCounter();
+    if(counter >= 0)
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = lookup_keys[index];
+        Container_LookupHashNode(
+                                 Container_HashUInt(key),
+                                 &key,
+                                 &hash,
+                                 &BenchLookup,
+                                 NULL,
+                                 &searched_bucket
+                                );
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+    tlb_misses  = ReadTLBCounter(counter);
+
+    if(counter >= 0)
+        close(counter);
+
+    printf(
+           "%-12s (allocated as %d) %8.1f %s/lookup",
+           name,
+           (int)hash.alloc_type,
+           (double)total_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    if(tlb_misses >= 0)
+        printf(" %6.3f dTLB misses/lookup\n", (double)tlb_misses/LOOKUP_COUNT);
+    else
+        printf(" (dTLB miss counter unavailable)\n");
+
+    Container_DestroyHash(&hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct bench_entry* entries;
+    unsigned int*       lookup_keys;
+    uint64_t            random_state;
+
+    entries     = malloc(sizeof(*entries)*KEY_COUNT);
+    lookup_keys = malloc(sizeof(*lookup_keys)*LOOKUP_COUNT);
+    if(entries == NULL || lookup_keys == NULL)
+        return EXIT_FAILURE;
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        entries[index].key = index;
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        lookup_keys[index] = (unsigned int)(Bench_Random(&random_state)%KEY_COUNT);
+
+    RunBenchmark("malloc", container__hash_alloc_default, entries, lookup_keys);
+    RunBenchmark("huge pages", container__hash_alloc_huge_pages, entries, lookup_keys);
+
+    free(lookup_keys);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares lookups through Container_LookupHashNode, which calls the lookup function through
+    a pointer for every node visited, against lookups through functions generated with
+    CONTAINER__DEFINE_HASH, which compare keys inline.  Half of the lookups miss, and the
+    table is loaded so that each bucket holds a few nodes
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/hashfn.h>
+#include <container/hashgen.h>
+
+#include "bench.h"
+
+
+#define KEY_COUNT    (1u << 16)
+#define BUCKET_SHIFT 14
+#define LOOKUP_COUNT (1u << 23)
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static inline enum container__hash_cmp_result
+BenchTest (unsigned int, unsigned int);
+
+
+CONTAINER__DEFINE_HASH(
+                       Bench,
+                       EntryHash,
+                       struct bench_entry,
+                       node,
+                       unsigned int,
+                       key,
+                       Container_HashUInt,
+                       BenchTest
+                      )
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    return BenchTest(*(unsigned int*)lookup_key, entry->key);
+}
+
+static inline enum container__hash_cmp_result
+BenchTest (unsigned int l_key, unsigned int r_key)
+{
+    if(l_key == r_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__hash         hash;
+    struct container__hash_bucket* searched_bucket;
+    struct bench_entry*            entries;
+    unsigned int*                  lookup_keys;
+    unsigned long                  found_count;
+    uint64_t                       random_state;
+    uint64_t                       start_ticks;
+    uint64_t                       callback_ticks;
+    uint64_t                       typed_ticks;
+
+    entries     = malloc(sizeof(*entries)*KEY_COUNT);
+    lookup_keys = malloc(sizeof(*lookup_keys)*LOOKUP_COUNT);
+    if(entries == NULL || lookup_keys == NULL)
+        return EXIT_FAILURE;
+
+    if(Container_CreateHashShift(BUCKET_SHIFT, &hash) != container__error_none)
+        return EXIT_FAILURE;
+
+    /* Even keys are added, so odd lookup keys miss */
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        BenchAddEntryHash(index*2, &entries[index], &hash);
+
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+        lookup_keys[index] = (unsigned int)(Bench_Random(&random_state)%(KEY_COUNT*2));
+
+    found_count = 0;
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = lookup_keys[index];
+        if(Container_LookupHashNode(
+                                    Container_HashUInt(key),
+                                    &key,
+                                    &hash,
+                                    &BenchLookup,
+                                    NULL,
+                                    &searched_bucket
+                                   ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    callback_ticks = Bench_Ticks()-start_ticks;
+    start_ticks    = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        if(BenchLookupEntryHash(lookup_keys[index], &hash, &searched_bucket) != NULL)
+            found_count--;
+    }
+
+    typed_ticks = Bench_Ticks()-start_ticks;
+
+    if(found_count != 0)
+        return EXIT_FAILURE;
+
+    printf(
+           "callback lookup  %6.1f %s/lookup\n",
+           (double)callback_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    printf(
+           "generated lookup %6.1f %s/lookup\n",
+           (double)typed_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT
+          );
+
+    Container_DestroyHash(&hash);
+
+    free(lookup_keys);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
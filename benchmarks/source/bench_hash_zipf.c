@@ -0,0 +1,250 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+/*
+    Compares the number of lookup function invocations per lookup, and the time per lookup,
+    of Container_LookupHashNode against the move to front and transpose lookups when the key
+    popularity follows a Zipf distribution.  The table is deliberately overloaded so that
+    each bucket holds several nodes
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <container/utils.h>
+#include <container/hash.h>
+
+#include "bench.h"
+
+
+#define KEY_COUNT     (1u << 16)
+#define BUCKET_SHIFT  13
+#define LOOKUP_COUNT  (1u << 22)
+#define ZIPF_EXPONENT 0.99
+
+
+enum bench_mode
+{
+    bench_mode_plain,
+    bench_mode_transpose,
+    bench_mode_move_front
+};
+
+
+struct bench_entry
+{
+    unsigned int key;
+
+    struct container__hash_node node;
+};
+
+
+static enum container__hash_cmp_result
+BenchLookup (void*, struct container__hash_node* restrict, void*);
+
+static unsigned int
+ZipfRank (double, const double* restrict);
+
+static void
+RunBenchmark (
+              const char*,
+              enum bench_mode,
+              struct bench_entry* restrict,
+              const unsigned int* restrict
+             );
+
+
+static enum container__hash_cmp_result
+BenchLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct bench_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct bench_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+/*
+    Returns the rank whose cumulative probability first reaches the uniform value
+ */
+static unsigned int
+ZipfRank (double uniform, const double* restrict cumulative)
+{
+    unsigned int low;
+    unsigned int high;
+
+    low  = 0;
+    high = KEY_COUNT-1;
+
+    while(low < high)
+    {
+        unsigned int middle;
+
+        middle = low+(high-low)/2;
+        if(cumulative[middle] < uniform)
+            low = middle+1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+static void
+RunBenchmark (
+              const char*                  name,
+              enum bench_mode              mode,
+              struct bench_entry* restrict entries,
+              const unsigned int* restrict lookup_keys
+             )
+{
+    struct container__hash          hash;
+    struct container__hash_counters counters;
+    struct container__hash_bucket*  searched_bucket;
+    uint64_t                        start_ticks;
+    uint64_t                        total_ticks;
+
+    if(Container_CreateHashShift(BUCKET_SHIFT, &hash) != container__error_none)
+        exit(EXIT_FAILURE);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        Container_AddHashNode(entries[index].key, &entries[index].node, &hash);
+
+    Container_SetHashCounters(&counters, &hash);
+
+    start_ticks = Bench_Ticks();
+
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        unsigned int key;
+
+        key = lookup_keys[index];
+
+        switch(mode)
+        {
+        case bench_mode_plain:
+            Container_LookupHashNode(key, &key, &hash, &BenchLookup, NULL, &searched_bucket);
+            break;
+
+        case bench_mode_transpose:
+            Container_LookupHashNodeTranspose(
+                                              key,
+                                              &key,
+                                              &hash,
+                                              &BenchLookup,
+                                              NULL,
+                                              &searched_bucket
+                                             );
+            break;
+
+        default:
+            Container_LookupHashNodeMoveFront(
+                                              key,
+                                              &key,
+                                              &hash,
+                                              &BenchLookup,
+                                              NULL,
+                                              &searched_bucket
+                                             );
+            break;
+        }
+    }
+
+    total_ticks = Bench_Ticks()-start_ticks;
+
+    printf(
+           "%-16s %6.2f compares/lookup %8.1f %s/lookup (%lu found)\n",
+           name,
+           (double)counters.compare_count/counters.lookup_count,
+           (double)total_ticks/LOOKUP_COUNT,
+           BENCH__TICK_UNIT,
+           counters.found_count
+          );
+
+    Container_DestroyHash(&hash);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct bench_entry* entries;
+    unsigned int*       lookup_keys;
+    double*             cumulative;
+    double              total;
+    uint64_t            random_state;
+
+    entries     = malloc(sizeof(*entries)*KEY_COUNT);
+    lookup_keys = malloc(sizeof(*lookup_keys)*LOOKUP_COUNT);
+    cumulative  = malloc(sizeof(*cumulative)*KEY_COUNT);
+    if(entries == NULL || lookup_keys == NULL || cumulative == NULL)
+        return EXIT_FAILURE;
+
+    total = 0;
+    for(unsigned int rank = 0; rank < KEY_COUNT; rank++)
+    {
+        total            += 1.0/pow(rank+1, ZIPF_EXPONENT);
+        cumulative[rank]  = total;
+    }
+
+    for(unsigned int rank = 0; rank < KEY_COUNT; rank++)
+        cumulative[rank] /= total;
+
+    /* Entries are shuffled so that popularity is unrelated to insertion order */
+    random_state = 2463534242ull;
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        entries[index].key = index;
+
+    for(unsigned int index = KEY_COUNT; index-- > 1;)
+    {
+        unsigned int other;
+        unsigned int key;
+
+        other = (unsigned int)(Bench_Random(&random_state)%(index+1));
+        key   = entries[index].key;
+
+        entries[index].key = entries[other].key;
+        entries[other].key = key;
+    }
+
+    /* The key of rank r is r, so the hottest keys are spread across the table */
+    for(unsigned int index = 0; index < LOOKUP_COUNT; index++)
+    {
+        double uniform;
+
+        uniform            = (double)(Bench_Random(&random_state)>>11)*0x1.0p-53;
+        lookup_keys[index] = ZipfRank(uniform, cumulative);
+    }
+
+    RunBenchmark("insertion order", bench_mode_plain, entries, lookup_keys);
+    RunBenchmark("transpose", bench_mode_transpose, entries, lookup_keys);
+    RunBenchmark("move to front", bench_mode_move_front, entries, lookup_keys);
+
+    free(cumulative);
+    free(lookup_keys);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The allocator interface used by every container function which allocates memory.  Each
+    such function has a WithAllocator variant taking an allocator, which the container keeps
+    and uses for all of its later allocations and releases, so that containers may be placed
+    in arenas, per-node pools or shared memory.  Passing NULL, as the functions without an
+    allocator do, allocates with malloc and releases with free
+ */
+
+
+#ifndef _CONTAINER__ALLOC_H_
+#define _CONTAINER__ALLOC_H_
+
+
+#include <stddef.h>
+
+
+/*
+    The required type for a user-defined allocation function.  The function is passed the
+    size of the allocation, the alignment of the allocator, and the allocator user data, and
+    returns NULL should the allocation fail
+
+    For example:
+        void*
+        MyAlloc (size_t size, size_t alignment, void* user_data)
+        {
+            return MyArenaAlloc(user_data, size, alignment);
+        }
+ */
+typedef void*
+(*container__allocator_alloc_type) (size_t, size_t, void*);
+
+/*
+    The required type for a user-defined release function.  The function is passed the
+    address and size of an earlier allocation, and the allocator user data
+
+    For example:
+        void
+        MyFree (void* address, size_t size, void* user_data)
+        {
+            MyArenaFree(user_data, address, size);
+        }
+ */
+typedef void
+(*container__allocator_free_type) (void*, size_t, void*);
+
+
+/*
+    An allocator.  Containers keep a pointer to the allocator, so it must outlive every
+    container created with it
+
+    Accessible members:
+        alloc     -- the allocation function
+        free      -- the release function
+        user_data -- the user data passed to both functions
+        alignment -- the alignment passed to the allocation function for every allocation
+ */
+struct container__allocator
+{
+    container__allocator_alloc_type alloc;
+    container__allocator_free_type  free;
+    void*                           user_data;
+    size_t                          alignment;
+};
+
+
+/*
+    Allocate memory with an allocator, or with malloc if the allocator is NULL
+
+    Syntax:
+        memory = Container_AllocMemory(size, &my_allocator);
+ */
+inline void*
+Container_AllocMemory (size_t, const struct container__allocator*);
+
+/*
+    Allocate zeroed memory with an allocator, or with calloc if the allocator is NULL
+
+    Syntax:
+        memory = Container_AllocZeroMemory(size, &my_allocator);
+ */
+inline void*
+Container_AllocZeroMemory (size_t, const struct container__allocator*);
+
+/*
+    Resize memory allocated with an allocator, preserving its contents up to the smaller of
+    the two sizes.  NULL is returned should the allocation fail, in which case the original
+    memory is left allocated
+
+    Syntax:
+        memory = Container_ReallocMemory(memory, old_size, new_size, &my_allocator);
+ */
+inline void*
+Container_ReallocMemory (void*, size_t, size_t, const struct container__allocator*);
+
+/*
+    Release memory allocated with an allocator
+
+    Syntax:
+        Container_FreeMemory(memory, size, &my_allocator);
+ */
+inline void
+Container_FreeMemory (void*, size_t, const struct container__allocator*);
+
+
+#include <stdlib.h>
+#include <string.h>
+
+
+inline void*
+Container_AllocMemory (size_t size, const struct container__allocator* allocator)
+{
+    if(allocator == NULL)
+        return malloc(size);
+
+    return (*allocator->alloc)(size, allocator->alignment, allocator->user_data);
+}
+
+inline void*
+Container_AllocZeroMemory (size_t size, const struct container__allocator* allocator)
+{
+    void* memory;
+
+    if(allocator == NULL)
+        return calloc(1, size);
+
+    memory = Container_AllocMemory(size, allocator);
+    if(memory != NULL)
+        memset(memory, 0, size);
+
+    return memory;
+}
+
+inline void*
+Container_ReallocMemory (
+                         void*                              memory,
+                         size_t                             old_size,
+                         size_t                             new_size,
+                         const struct container__allocator* allocator
+                        )
+{
+    void* new_memory;
+
+    if(allocator == NULL)
+        return realloc(memory, new_size);
+
+    new_memory = Container_AllocMemory(new_size, allocator);
+    if(new_memory == NULL)
+        return NULL;
+
+    if(memory != NULL)
+    {
+        memcpy(new_memory, memory, old_size < new_size ? old_size : new_size);
+
+        Container_FreeMemory(memory, old_size, allocator);
+    }
+
+    return new_memory;
+}
+
+inline void
+Container_FreeMemory (void* memory, size_t size, const struct container__allocator* allocator)
+{
+    if(allocator == NULL)
+    {
+        free(memory);
+
+        return;
+    }
+
+    if(memory != NULL)
+        (*allocator->free)(memory, size, allocator->user_data);
+}
+
+
+#endif
@@ -0,0 +1,414 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    Binary keys of a fixed 16 or 32 byte width, or of any length along with their hash value,
+    and the equality and hash functions used to look them up.  The equality functions only
+    report whether two keys match rather than how they order, so they compare 16 bytes at a
+    time with SSE2 or NEON, or 32 bytes at a time with AVX2 when the library is built for it.
+    Keys longer than 64 bytes are also compared with AVX2 on x86 when the processor running the
+    program supports it.  Other targets fall back to memcmp
+ */
+
+
+#ifndef _CONTAINER__BLOB_H_
+#define _CONTAINER__BLOB_H_
+
+
+#include <stddef.h>
+
+
+/*
+    The widths of the fixed width keys
+ */
+#define CONTAINER__BLOB16_SIZE 16
+#define CONTAINER__BLOB32_SIZE 32
+
+
+/*
+    A 16 byte key
+
+    Accessible members:
+        bytes -- the key itself
+ */
+struct container__blob16
+{
+    unsigned char bytes[CONTAINER__BLOB16_SIZE];
+};
+
+/*
+    A 32 byte key
+
+    Accessible members:
+        bytes -- the key itself
+ */
+struct container__blob32
+{
+    unsigned char bytes[CONTAINER__BLOB32_SIZE];
+};
+
+/*
+    A key of any length along with its hash value, initialized with Container_InitBlob.  Keys
+    of different lengths or hash values are rejected without reading the bytes themselves
+
+    Accessible members:
+        bytes      -- the key, which must outlive any node holding it
+        length     -- the length of the key in bytes
+        value_hash -- the hash value of the key, as computed by Container_HashBytes
+ */
+struct container__blob
+{
+    const void*  bytes;
+    size_t       length;
+    unsigned int value_hash;
+};
+
+
+/*
+    Initialize a key with the specified bytes, computing its hash value
+
+    Syntax:
+        Container_InitBlob(my_bytes, my_bytes_length, &my_blob);
+ */
+inline void
+Container_InitBlob (const void*, size_t, struct container__blob* restrict);
+
+/*
+    Return the hash value of a 16 byte key
+
+    Syntax:
+        value_hash = Container_HashBlob16(my_blob16);
+ */
+inline unsigned int
+Container_HashBlob16 (struct container__blob16);
+
+/*
+    Return the hash value of a 32 byte key
+
+    Syntax:
+        value_hash = Container_HashBlob32(my_blob32);
+ */
+inline unsigned int
+Container_HashBlob32 (struct container__blob32);
+
+/*
+    Return nonzero if the 16 bytes at each address are equal
+
+    Syntax:
+        if(Container_Blob16Equal(my_bytes, other_bytes))
+            ...
+ */
+inline int
+Container_Blob16Equal (const void* restrict, const void* restrict);
+
+/*
+    Return nonzero if the 32 bytes at each address are equal
+
+    Syntax:
+        if(Container_Blob32Equal(my_bytes, other_bytes))
+            ...
+ */
+inline int
+Container_Blob32Equal (const void* restrict, const void* restrict);
+
+/*
+    Return nonzero if the specified number of bytes at each address are equal
+
+    Syntax:
+        if(Container_BlobEqual(my_bytes, other_bytes, my_bytes_length))
+            ...
+ */
+inline int
+Container_BlobEqual (const void* restrict, const void* restrict, size_t);
+
+
+#include <container/hashfn.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*
+    Without AVX2 enabled at build time, x86 builds with GCC or Clang compile the AVX2 kernels
+    for that target alone and choose them only when the processor reports support
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#include <immintrin.h>
+#define CONTAINER__BLOB_AVX2_DISPATCH
+#endif
+
+
+inline int
+Container_Blob64Equal (const unsigned char* restrict, const unsigned char* restrict);
+
+inline int
+Container_BlobEqualWide (const unsigned char* restrict, const unsigned char* restrict, size_t);
+
+#if defined(CONTAINER__BLOB_AVX2_DISPATCH)
+inline int
+Container_Blob64EqualAVX2 (const unsigned char* restrict, const unsigned char* restrict)
+__attribute__((target("avx2")));
+
+inline int
+Container_BlobEqualWideAVX2 (const unsigned char* restrict, const unsigned char* restrict, size_t)
+__attribute__((target("avx2")));
+#endif
+
+
+inline int
+Container_Blob64Equal (const unsigned char* restrict l_bytes, const unsigned char* restrict r_bytes)
+{
+    /*
+        Both halves are always compared so that only one branch is taken per block
+     */
+    return Container_Blob32Equal(l_bytes, r_bytes)&
+           Container_Blob32Equal(l_bytes+CONTAINER__BLOB32_SIZE, r_bytes+CONTAINER__BLOB32_SIZE);
+}
+
+inline int
+Container_BlobEqualWide (
+                         const unsigned char* restrict l_bytes,
+                         const unsigned char* restrict r_bytes,
+                         size_t                        length
+                        )
+{
+    size_t offset;
+
+    /*
+        The final block overlaps the one before it rather than being compared byte by byte,
+        which is harmless since only equality is reported
+     */
+    for(offset = 0; offset+2*CONTAINER__BLOB32_SIZE < length; offset += 2*CONTAINER__BLOB32_SIZE)
+    {
+        if(!Container_Blob64Equal(l_bytes+offset, r_bytes+offset))
+            return 0;
+    }
+
+    return Container_Blob64Equal(
+                                 l_bytes+length-2*CONTAINER__BLOB32_SIZE,
+                                 r_bytes+length-2*CONTAINER__BLOB32_SIZE
+                                );
+}
+
+#if defined(CONTAINER__BLOB_AVX2_DISPATCH)
+__attribute__((target("avx2"))) inline int
+Container_Blob64EqualAVX2 (
+                           const unsigned char* restrict l_bytes,
+                           const unsigned char* restrict r_bytes
+                          )
+{
+    __m256i differences;
+
+    differences = _mm256_or_si256(
+                                  _mm256_xor_si256(
+                                                   _mm256_loadu_si256((const __m256i*)l_bytes),
+                                                   _mm256_loadu_si256((const __m256i*)r_bytes)
+                                                  ),
+                                  _mm256_xor_si256(
+                                                   _mm256_loadu_si256((const __m256i*)l_bytes+1),
+                                                   _mm256_loadu_si256((const __m256i*)r_bytes+1)
+                                                  )
+                                 );
+
+    return _mm256_testz_si256(differences, differences);
+}
+
+__attribute__((target("avx2"))) inline int
+Container_BlobEqualWideAVX2 (
+                             const unsigned char* restrict l_bytes,
+                             const unsigned char* restrict r_bytes,
+                             size_t                        length
+                            )
+{
+    size_t offset;
+
+    for(offset = 0; offset+2*CONTAINER__BLOB32_SIZE < length; offset += 2*CONTAINER__BLOB32_SIZE)
+    {
+        if(!Container_Blob64EqualAVX2(l_bytes+offset, r_bytes+offset))
+            return 0;
+    }
+
+    return Container_Blob64EqualAVX2(
+                                     l_bytes+length-2*CONTAINER__BLOB32_SIZE,
+                                     r_bytes+length-2*CONTAINER__BLOB32_SIZE
+                                    );
+}
+#endif
+
+
+inline void
+Container_InitBlob (const void* bytes, size_t length, struct container__blob* restrict blob)
+{
+    blob->bytes      = bytes;
+    blob->length     = length;
+    blob->value_hash = Container_HashBytes(bytes, length, CONTAINER__HASHFN_DEFAULT_SEED);
+}
+
+inline unsigned int
+Container_HashBlob16 (struct container__blob16 value)
+{
+    return Container_HashBytes(value.bytes, CONTAINER__BLOB16_SIZE, CONTAINER__HASHFN_DEFAULT_SEED);
+}
+
+inline unsigned int
+Container_HashBlob32 (struct container__blob32 value)
+{
+    return Container_HashBytes(value.bytes, CONTAINER__BLOB32_SIZE, CONTAINER__HASHFN_DEFAULT_SEED);
+}
+
+inline int
+Container_Blob16Equal (const void* restrict l_bytes, const void* restrict r_bytes)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i l_block;
+    __m128i r_block;
+
+    l_block = _mm_loadu_si128((const __m128i*)l_bytes);
+    r_block = _mm_loadu_si128((const __m128i*)r_bytes);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(l_block, r_block)) == 0xFFFF;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t matches;
+
+    matches = vceqq_u8(vld1q_u8(l_bytes), vld1q_u8(r_bytes));
+
+    return vminvq_u8(matches) == 0xFF;
+#else
+    return memcmp(l_bytes, r_bytes, CONTAINER__BLOB16_SIZE) == 0;
+#endif
+}
+
+inline int
+Container_Blob32Equal (const void* restrict l_bytes, const void* restrict r_bytes)
+{
+#if defined(__AVX2__)
+    __m256i l_block;
+    __m256i r_block;
+
+    l_block = _mm256_loadu_si256((const __m256i*)l_bytes);
+    r_block = _mm256_loadu_si256((const __m256i*)r_bytes);
+
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(l_block, r_block)) == -1;
+#elif defined(__SSE2__) || defined(_M_X64)
+    __m128i matches;
+
+    /*
+        Two SSE2 compares are made inline rather than calling the AVX2 kernel, since a single
+        block is too short for the call to pay for itself
+     */
+    matches = _mm_and_si128(
+                            _mm_cmpeq_epi8(
+                                           _mm_loadu_si128((const __m128i*)l_bytes),
+                                           _mm_loadu_si128((const __m128i*)r_bytes)
+                                          ),
+                            _mm_cmpeq_epi8(
+                                           _mm_loadu_si128((const __m128i*)l_bytes+1),
+                                           _mm_loadu_si128((const __m128i*)r_bytes+1)
+                                          )
+                           );
+
+    return _mm_movemask_epi8(matches) == 0xFFFF;
+#else
+    const unsigned char* l_block;
+    const unsigned char* r_block;
+
+    l_block = l_bytes;
+    r_block = r_bytes;
+
+    return Container_Blob16Equal(l_block, r_block) &&
+           Container_Blob16Equal(l_block+CONTAINER__BLOB16_SIZE, r_block+CONTAINER__BLOB16_SIZE);
+#endif
+}
+
+inline int
+Container_BlobEqual (const void* restrict l_bytes, const void* restrict r_bytes, size_t length)
+{
+    const unsigned char* l_block;
+    const unsigned char* r_block;
+
+    l_block = l_bytes;
+    r_block = r_bytes;
+
+    /*
+        Keys of up to 64 bytes are compared inline as two blocks or words, which overlap when
+        the length isn't a multiple of their size, so no key is walked a byte at a time unless
+        it is shorter than 4 bytes.  Only longer keys are worth the call to the AVX2 kernels
+     */
+    if(length > 2*CONTAINER__BLOB32_SIZE)
+    {
+#if defined(CONTAINER__BLOB_AVX2_DISPATCH)
+        if(__builtin_cpu_supports("avx2"))
+            return Container_BlobEqualWideAVX2(l_block, r_block, length);
+#endif
+
+        return Container_BlobEqualWide(l_block, r_block, length);
+    }
+
+    if(length >= CONTAINER__BLOB32_SIZE)
+    {
+        return Container_Blob32Equal(l_block, r_block)&
+               Container_Blob32Equal(
+                                     l_block+length-CONTAINER__BLOB32_SIZE,
+                                     r_block+length-CONTAINER__BLOB32_SIZE
+                                    );
+    }
+
+    if(length >= CONTAINER__BLOB16_SIZE)
+    {
+        return Container_Blob16Equal(l_block, r_block)&
+               Container_Blob16Equal(
+                                     l_block+length-CONTAINER__BLOB16_SIZE,
+                                     r_block+length-CONTAINER__BLOB16_SIZE
+                                    );
+    }
+
+    if(length >= 8)
+    {
+        return (Container_HashRead64(l_block) == Container_HashRead64(r_block))&
+               (Container_HashRead64(l_block+length-8) == Container_HashRead64(r_block+length-8));
+    }
+
+    if(length >= 4)
+    {
+        return (Container_HashRead32(l_block) == Container_HashRead32(r_block))&
+               (Container_HashRead32(l_block+length-4) == Container_HashRead32(r_block+length-4));
+    }
+
+    while(length > 0)
+    {
+        length--;
+
+        if(l_block[length] != r_block[length])
+            return 0;
+    }
+
+    return 1;
+}
+
+
+#endif
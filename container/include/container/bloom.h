@@ -0,0 +1,569 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The bloom container is a blocked Bloom filter, kept alongside a hash to turn away lookups
+    for values which were never added before any bucket is visited.  Each value maps to a
+    single cache line sized block, and sets one bit in each word of that block, so adding or
+    testing a value touches one cache line and the per word work is uniform and vectorizable.
+
+    A Bloom filter never reports an added value as absent, but may report a value which was
+    never added as present.  Bits can't be cleared when a value is removed, since other values
+    may share them, so removals are only counted and the filter should be rebuilt from the
+    hash once enough have accumulated, with Container_RebuildHashBloom.
+
+    The filter takes the hash value of each value and derives the block and bits from it, so
+    the hash values should be well mixed in all of their bits
+ */
+
+
+#ifndef _CONTAINER__BLOOM_H_
+#define _CONTAINER__BLOOM_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hash.h>
+
+
+/*
+    The number of words in each block, each holding one bit of every value in the block
+ */
+#define CONTAINER__BLOOM_BLOCK_WORDS 8
+
+/*
+    The size of each block, and the alignment of the blocks
+ */
+#define CONTAINER__BLOOM_BLOCK_SIZE 64
+
+
+/*
+    Valid results of testing a bloom for a value
+ */
+enum container__bloom_result
+{
+    container__bloom_value_absent,
+    container__bloom_value_maybe_present
+};
+
+
+/*
+    A block of the filter
+ */
+struct container__bloom_block
+{
+    unsigned long long words[CONTAINER__BLOOM_BLOCK_WORDS];
+};
+
+/*
+    The bloom container itself.  The lookup counts are kept by Container_LookupBloomHashNode
+
+    Accessible members:
+        block_count          -- the number of blocks in the filter
+        value_count          -- the number of values added since the filter was last reset
+        removed_count        -- the number of values removed since the filter was last reset
+        test_count           -- the number of lookups made through the filter
+        rejected_count       -- the number of lookups turned away by the filter
+        false_positive_count -- the number of lookups passed by the filter which found nothing
+        allocator            -- the allocator used for the blocks
+ */
+struct container__bloom
+{
+    unsigned int                       block_count;
+    unsigned long                      value_count;
+    unsigned long                      removed_count;
+    unsigned long                      test_count;
+    unsigned long                      rejected_count;
+    unsigned long                      false_positive_count;
+    struct container__bloom_block*     blocks;
+    void*                              alloc_address;
+    const struct container__allocator* allocator;
+};
+
+/*
+    The statistics of a bloom, as reported by Container_BloomStats
+
+    Accessible members:
+        fill_ratio                    -- the fraction of bits set
+        stale_ratio                   -- the fraction of added values which have since been
+                                         removed, whose bits still raise false positives
+        estimated_false_positive_rate -- the chance that a value never added is reported as
+                                         present, computed from the bits set in each block
+        observed_false_positive_rate  -- the fraction of lookups through the filter for
+                                         values not in the hash which the filter passed
+ */
+struct container__bloom_stats
+{
+    double fill_ratio;
+    double stale_ratio;
+    double estimated_false_positive_rate;
+    double observed_false_positive_rate;
+};
+
+
+/*
+    Allocate and initialize a bloom sized for the specified number of values, using the
+    specified number of bits per value.  Around 10 bits per value gives a false positive rate
+    of around 1%, and each further 5 bits per value divides the rate by roughly 4.  The filter
+    will be empty upon initialization
+
+    Syntax:
+        error = Container_CreateBloom(expected_value_count, 10, &my_bloom);
+ */
+inline enum container__error_code
+Container_CreateBloom (unsigned long, unsigned int, struct container__bloom* restrict);
+
+/*
+    Allocate and initialize a bloom as with Container_CreateBloom, using an allocator
+
+    Syntax:
+        error = Container_CreateBloomWithAllocator(
+                                                   expected_value_count,
+                                                   10,
+                                                   &my_allocator,
+                                                   &my_bloom
+                                                  );
+ */
+inline enum container__error_code
+Container_CreateBloomWithAllocator (
+                                    unsigned long,
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__bloom* restrict
+                                   );
+
+/*
+    Cleanup a previously created bloom
+
+    Syntax:
+        Container_DestroyBloom(&my_bloom);
+ */
+inline void
+Container_DestroyBloom (struct container__bloom* restrict);
+
+
+/*
+    Reset a bloom to the initialized state, clearing every bit and count
+
+    Syntax:
+        Container_ResetBloom(&my_bloom);
+ */
+inline void
+Container_ResetBloom (struct container__bloom* restrict);
+
+
+/*
+    Add a value to the bloom
+
+    Syntax:
+        Container_AddBloomValue(MyHashValue(my_element.my_id), &my_bloom);
+ */
+inline void
+Container_AddBloomValue (unsigned int, struct container__bloom* restrict);
+
+/*
+    Record that a value has been removed.  The value's bits remain set until the filter is
+    rebuilt
+
+    Syntax:
+        Container_RemoveBloomValue(&my_bloom);
+ */
+inline void
+Container_RemoveBloomValue (struct container__bloom* restrict);
+
+/*
+    Test whether a value may have been added to the bloom
+
+    Syntax:
+        result = Container_TestBloomValue(MyHashValue(lookup_id), &my_bloom);
+ */
+inline enum container__bloom_result
+Container_TestBloomValue (unsigned int, struct container__bloom* restrict);
+
+
+/*
+    Lookup a node in a hash, first testing the bloom kept alongside it.  The hash is only
+    searched once the filter passes.  The searched bucket is set whether or not the filter
+    turned the lookup away, so a node may be inserted after a failed lookup as with
+    Container_LookupHashNode, though its value must then be added to the filter with
+    Container_AddBloomValue.  Lookups in an hlist may be filtered the same way by testing the
+    filter before Container_LookupHListNode
+
+    Syntax:
+        found_node = Container_LookupBloomHashNode(
+                                                   MyHashValue(lookup_id),
+                                                   &lookup_id,
+                                                   &my_bloom,
+                                                   &my_hash,
+                                                   &MyLookup,
+                                                   my_user_data,
+                                                   &searched_bucket
+                                                  );
+ */
+inline struct container__hash_node*
+Container_LookupBloomHashNode (
+                               unsigned int,
+                               void*,
+                               struct container__bloom* restrict,
+                               struct container__hash* restrict,
+                               container__hash_lookup_type,
+                               void*,
+                               struct container__hash_bucket** restrict
+                              );
+
+/*
+    Add a node to a hash and its value to the bloom kept alongside it
+
+    Syntax:
+        Container_AddBloomHashNode(
+                                   MyHashValue(my_element.my_id),
+                                   &my_element.node,
+                                   &my_bloom,
+                                   &my_hash
+                                  );
+ */
+inline void
+Container_AddBloomHashNode (
+                            unsigned int,
+                            struct container__hash_node* restrict,
+                            struct container__bloom* restrict,
+                            struct container__hash* restrict
+                           );
+
+/*
+    Remove a node from a hash and record the removal in the bloom kept alongside it
+
+    Syntax:
+        Container_RemoveBloomHashNode(&my_element.node, &my_bloom);
+ */
+inline void
+Container_RemoveBloomHashNode (
+                               struct container__hash_node* restrict,
+                               struct container__bloom* restrict
+                              );
+
+/*
+    Reset the bloom and add the value of every node in a hash, dropping the bits of removed
+    values.  The value function computes the hash value of each node
+
+    Syntax:
+        Container_RebuildHashBloom(&my_hash, &MyHashValue, my_user_data, &my_bloom);
+ */
+inline void
+Container_RebuildHashBloom (
+                            struct container__hash* restrict,
+                            container__hash_value_type,
+                            void*,
+                            struct container__bloom* restrict
+                           );
+
+
+/*
+    Compute the statistics of a bloom.  Every block is visited, so this takes time
+    proportional to the size of the filter
+
+    Syntax:
+        Container_BloomStats(&my_bloom, &my_stats);
+ */
+inline void
+Container_BloomStats (struct container__bloom* restrict, struct container__bloom_stats* restrict);
+
+
+#include <container/utils.h>
+#include <container/hashfn.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+inline struct container__bloom_block*
+Container_BloomBlock (unsigned int, struct container__bloom* restrict);
+
+inline unsigned long long
+Container_BloomBit (unsigned int, unsigned int);
+
+
+inline struct container__bloom_block*
+Container_BloomBlock (unsigned int value_hash, struct container__bloom* restrict bloom)
+{
+    uint64_t mixed_hash;
+
+    /* Remix the hash so the block doesn't depend on the bits which select bits in the block */
+    mixed_hash = Container_HashUInt(value_hash);
+
+    return &bloom->blocks[(mixed_hash*bloom->block_count)>>32];
+}
+
+inline unsigned long long
+Container_BloomBit (unsigned int value_hash, unsigned int word)
+{
+    static const uint32_t salts[CONTAINER__BLOOM_BLOCK_WORDS] =
+    {
+        UINT32_C(0x47B6137B), UINT32_C(0x44974D91), UINT32_C(0x8824AD5B), UINT32_C(0xA2B7289D),
+        UINT32_C(0x705495C7), UINT32_C(0x2DF1424B), UINT32_C(0x9EFC4947), UINT32_C(0x5C6BFB31)
+    };
+
+    return 1ull<<(((uint32_t)value_hash*salts[word])>>26);
+}
+
+
+inline enum container__error_code
+Container_CreateBloom (
+                       unsigned long                     count,
+                       unsigned int                      bits_per_value,
+                       struct container__bloom* restrict bloom
+                      )
+{
+    return Container_CreateBloomWithAllocator(count, bits_per_value, NULL, bloom);
+}
+
+inline enum container__error_code
+Container_CreateBloomWithAllocator (
+                                    unsigned long                      count,
+                                    unsigned int                       bits_per_value,
+                                    const struct container__allocator* allocator,
+                                    struct container__bloom* restrict  bloom
+                                   )
+{
+    unsigned long long block_count;
+    char*              address;
+
+    block_count = ((unsigned long long)count*bits_per_value+CONTAINER__BLOOM_BLOCK_SIZE*8-1)/
+                  (CONTAINER__BLOOM_BLOCK_SIZE*8);
+    if(block_count == 0)
+        block_count = 1;
+    if(block_count > UINT32_MAX)
+        return container__error_resource_unavailable;
+
+    address = Container_AllocMemory(
+                                    sizeof(struct container__bloom_block)*(size_t)block_count+
+                                    CONTAINER__BLOOM_BLOCK_SIZE-1,
+                                    allocator
+                                   );
+    if(address == NULL)
+        return container__error_memory_alloc;
+
+    bloom->block_count   = (unsigned int)block_count;
+    bloom->blocks        = (void*)(((uintptr_t)address+CONTAINER__BLOOM_BLOCK_SIZE-1)&
+                                   ~(uintptr_t)(CONTAINER__BLOOM_BLOCK_SIZE-1));
+    bloom->alloc_address = address;
+    bloom->allocator     = allocator;
+
+    Container_ResetBloom(bloom);
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyBloom (struct container__bloom* restrict bloom)
+{
+    Container_FreeMemory(
+                         bloom->alloc_address,
+                         sizeof(struct container__bloom_block)*bloom->block_count+
+                         CONTAINER__BLOOM_BLOCK_SIZE-1,
+                         bloom->allocator
+                        );
+}
+
+inline void
+Container_ResetBloom (struct container__bloom* restrict bloom)
+{
+    memset(bloom->blocks, 0, sizeof(struct container__bloom_block)*bloom->block_count);
+
+    bloom->value_count          = 0;
+    bloom->removed_count        = 0;
+    bloom->test_count           = 0;
+    bloom->rejected_count       = 0;
+    bloom->false_positive_count = 0;
+}
+
+inline void
+Container_AddBloomValue (unsigned int value_hash, struct container__bloom* restrict bloom)
+{
+    struct container__bloom_block* block;
+
+    block = Container_BloomBlock(value_hash, bloom);
+
+    for(unsigned int word = 0; word < CONTAINER__BLOOM_BLOCK_WORDS; word++)
+        block->words[word] |= Container_BloomBit(value_hash, word);
+
+    bloom->value_count++;
+}
+
+inline void
+Container_RemoveBloomValue (struct container__bloom* restrict bloom)
+{
+    bloom->removed_count++;
+}
+
+inline enum container__bloom_result
+Container_TestBloomValue (unsigned int value_hash, struct container__bloom* restrict bloom)
+{
+    struct container__bloom_block* block;
+    unsigned long long             missing;
+
+    block   = Container_BloomBlock(value_hash, bloom);
+    missing = 0;
+
+    /* Every word is tested without branching so the loop may be vectorized */
+    for(unsigned int word = 0; word < CONTAINER__BLOOM_BLOCK_WORDS; word++)
+        missing |= ~block->words[word]&Container_BloomBit(value_hash, word);
+
+    if(missing != 0)
+        return container__bloom_value_absent;
+
+    return container__bloom_value_maybe_present;
+}
+
+inline struct container__hash_node*
+Container_LookupBloomHashNode (
+                               unsigned int                             value_hash,
+                               void*                                    value,
+                               struct container__bloom* restrict        bloom,
+                               struct container__hash* restrict         hash,
+                               container__hash_lookup_type              lookup,
+                               void*                                    user_data,
+                               struct container__hash_bucket** restrict searched_bucket
+                              )
+{
+    struct container__hash_node* found_node;
+
+    bloom->test_count++;
+
+    if(Container_TestBloomValue(value_hash, bloom) == container__bloom_value_absent)
+    {
+        bloom->rejected_count++;
+
+        /* Only the bucket's address is needed, so a rejected lookup never reads the bucket */
+        *searched_bucket = Container_LookupHashBucket(value_hash, hash);
+
+        return NULL;
+    }
+
+    found_node = Container_LookupHashNode(
+                                          value_hash,
+                                          value,
+                                          hash,
+                                          lookup,
+                                          user_data,
+                                          searched_bucket
+                                         );
+    if(found_node == NULL)
+        bloom->false_positive_count++;
+
+    return found_node;
+}
+
+inline void
+Container_AddBloomHashNode (
+                            unsigned int                          value_hash,
+                            struct container__hash_node* restrict node,
+                            struct container__bloom* restrict     bloom,
+                            struct container__hash* restrict      hash
+                           )
+{
+    Container_AddBloomValue(value_hash, bloom);
+    Container_AddHashNode(value_hash, node, hash);
+}
+
+inline void
+Container_RemoveBloomHashNode (
+                               struct container__hash_node* restrict node,
+                               struct container__bloom* restrict     bloom
+                              )
+{
+    Container_RemoveHashNode(node);
+    Container_RemoveBloomValue(bloom);
+}
+
+inline void
+Container_RebuildHashBloom (
+                            struct container__hash* restrict  hash,
+                            container__hash_value_type        value,
+                            void*                             user_data,
+                            struct container__bloom* restrict bloom
+                           )
+{
+    struct container__hash_scan scan;
+
+    Container_ResetBloom(bloom);
+
+    for(
+        Container_StartHashScan(hash, &scan);
+        Container_HashScanState(&scan) == container__hash_scan_incomplete;
+        Container_ResumeHashScan(hash, &scan)
+       )
+    {
+        Container_AddBloomValue((*value)(scan.current_node, user_data), bloom);
+    }
+}
+
+inline void
+Container_BloomStats (
+                      struct container__bloom* restrict       bloom,
+                      struct container__bloom_stats* restrict stats
+                     )
+{
+    unsigned long long set_bits;
+    double             total_bits;
+    double             false_positive_sum;
+    unsigned long      negative_count;
+
+    set_bits           = 0;
+    false_positive_sum = 0.0;
+
+    for(unsigned int index = 0; index < bloom->block_count; index++)
+    {
+        struct container__bloom_block* block;
+        double                         block_rate;
+
+        block      = &bloom->blocks[index];
+        block_rate = 1.0;
+
+        /* A value never added passes only if its bit is set in every word of its block */
+        for(unsigned int word = 0; word < CONTAINER__BLOOM_BLOCK_WORDS; word++)
+        {
+            unsigned int word_bits;
+
+            word_bits   = (unsigned int)__builtin_popcountll(block->words[word]);
+            set_bits   += word_bits;
+            block_rate *= word_bits/64.0;
+        }
+
+        false_positive_sum += block_rate;
+    }
+
+    total_bits = (double)bloom->block_count*CONTAINER__BLOOM_BLOCK_SIZE*8;
+
+    stats->fill_ratio                    = set_bits/total_bits;
+    stats->stale_ratio                   = bloom->value_count > 0 ?
+                                           (double)bloom->removed_count/bloom->value_count : 0.0;
+    stats->estimated_false_positive_rate = false_positive_sum/bloom->block_count;
+
+    negative_count = bloom->rejected_count+bloom->false_positive_count;
+
+    stats->observed_false_positive_rate = negative_count > 0 ?
+                                          (double)bloom->false_positive_count/negative_count : 0.0;
+}
+
+
+#endif
@@ -0,0 +1,728 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The cache container bounds an hlist by a node count and a total node weight, evicting nodes
+    to make room as new ones are added.  Each evicted node is passed to an evict function so
+    that its element may be released.  Two eviction policies are provided.  The LRU policy
+    moves a node to the head of the list whenever a lookup finds it, and evicts from the tail.
+    The CLOCK policy gives each node a second chance instead: a lookup only marks the node as
+    referenced, so hits never relink nodes, and eviction moves referenced nodes from the tail
+    back to the head, clearing their mark, until it reaches one which is unmarked
+ */
+
+
+#ifndef _CONTAINER__CACHE_H_
+#define _CONTAINER__CACHE_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hlist.h>
+
+#include <stddef.h>
+
+
+/*
+    The eviction policies of a cache
+ */
+enum container__cache_policy
+{
+    container__cache_lru,
+    container__cache_clock
+};
+
+/*
+    Valid states for this container
+ */
+enum container__cache_state
+{
+    container__cache_populated,
+    container__cache_empty
+};
+
+/*
+    Valid results of a lookup function
+ */
+enum container__cache_cmp_result
+{
+    container__cache_node_not_equal,
+    container__cache_node_equal
+};
+
+
+/*
+    The node data to be placed in each cache element
+
+    Accessible members:
+        weight -- the weight the node was added with
+ */
+struct container__cache_node
+{
+    struct container__hlist_node node;
+    size_t                       weight;
+    unsigned int                 referenced;
+};
+
+
+/*
+    The required type for a user-defined lookup function, invoked for each node in the
+    searched bucket until one is found equal to the lookup value
+
+    For example:
+        enum container__cache_cmp_result
+        MyLookup (void* lookup_value, struct container__cache_node* restrict node, void* user_data)
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(node, struct my_element, cache_node);
+            if(element->my_key != *(unsigned int*)lookup_value)
+                return container__cache_node_not_equal;
+
+            return container__cache_node_equal;
+        }
+ */
+typedef enum container__cache_cmp_result
+(*container__cache_lookup_type) (void*, struct container__cache_node* restrict, void*);
+
+/*
+    The required type for a user-defined evict function, invoked once a node has been removed
+    from the cache to make room for others.  The evict function may release the node's element,
+    but must not use the cache
+
+    For example:
+        void
+        MyEvict (struct container__cache_node* restrict node, void* user_data)
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(node, struct my_element, cache_node);
+
+            free(element);
+        }
+ */
+typedef void
+(*container__cache_evict_type) (struct container__cache_node* restrict, void*);
+
+
+/*
+    The cache container itself.  A limit of zero leaves the node count or the weight unbounded
+
+    Accessible members:
+        policy         -- the eviction policy of the cache
+        node_count     -- the number of nodes in the cache
+        node_limit     -- the number of nodes the cache may hold
+        weight         -- the total weight of the nodes in the cache
+        weight_limit   -- the total weight the nodes in the cache may have
+        hit_count      -- the number of lookups which found a node
+        miss_count     -- the number of lookups which found no node
+        eviction_count -- the number of nodes evicted
+        allocator      -- the allocator used for the hash buckets
+ */
+struct container__cache
+{
+    struct container__hlist            hlist;
+    enum container__cache_policy       policy;
+    unsigned int                       node_count;
+    unsigned int                       node_limit;
+    size_t                             weight;
+    size_t                             weight_limit;
+    unsigned long long                 hit_count;
+    unsigned long long                 miss_count;
+    unsigned long long                 eviction_count;
+    container__cache_evict_type        evict;
+    void*                              user_data;
+    const struct container__allocator* allocator;
+};
+
+
+/*
+    Allocate the specified number of hash buckets and initialize a cache with the specified
+    policy and limits.  The buckets are never resized, so the bucket count should be about the
+    number of nodes the cache is expected to hold.  The evict function may be NULL
+
+    Syntax:
+        error = Container_CreateCache(
+                                      bucket_count,
+                                      container__cache_lru,
+                                      node_limit,
+                                      weight_limit,
+                                      &MyEvict,
+                                      my_user_data,
+                                      &my_cache
+                                     );
+ */
+inline enum container__error_code
+Container_CreateCache (
+                       unsigned int,
+                       enum container__cache_policy,
+                       unsigned int,
+                       size_t,
+                       container__cache_evict_type,
+                       void*,
+                       struct container__cache* restrict
+                      );
+
+/*
+    Allocate hash buckets using an allocator and initialize a cache
+
+    Syntax:
+        error = Container_CreateCacheWithAllocator(
+                                                   bucket_count,
+                                                   container__cache_clock,
+                                                   node_limit,
+                                                   weight_limit,
+                                                   &MyEvict,
+                                                   my_user_data,
+                                                   &my_allocator,
+                                                   &my_cache
+                                                  );
+ */
+inline enum container__error_code
+Container_CreateCacheWithAllocator (
+                                    unsigned int,
+                                    enum container__cache_policy,
+                                    unsigned int,
+                                    size_t,
+                                    container__cache_evict_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__cache* restrict
+                                   );
+
+/*
+    Cleanup a previously created cache.  Every node still in the cache is passed to the evict
+    function
+
+    Syntax:
+        Container_DestroyCache(&my_cache);
+ */
+inline void
+Container_DestroyCache (struct container__cache* restrict);
+
+
+/*
+    Find a node equal to the lookup value in the cache, or return NULL if there is none.  A
+    node found is marked as recently used according to the cache's policy.  The searched bucket
+    is returned so that a missing node may be added with Container_InsCacheNode
+
+    Syntax:
+        found_node = Container_LookupCacheNode(
+                                               value_hash,
+                                               &lookup_value,
+                                               &my_cache,
+                                               &MyLookup,
+                                               my_user_data,
+                                               &searched_bucket
+                                              );
+ */
+inline struct container__cache_node*
+Container_LookupCacheNode (
+                           unsigned int,
+                           void*,
+                           struct container__cache* restrict,
+                           container__cache_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+/*
+    Find a node as with Container_LookupCacheNode, without marking it as recently used or
+    counting the lookup as a hit or miss
+
+    Syntax:
+        found_node = Container_PeekCacheNode(
+                                             value_hash,
+                                             &lookup_value,
+                                             &my_cache,
+                                             &MyLookup,
+                                             my_user_data,
+                                             &searched_bucket
+                                            );
+ */
+inline struct container__cache_node*
+Container_PeekCacheNode (
+                         unsigned int,
+                         void*,
+                         struct container__cache* restrict,
+                         container__cache_lookup_type,
+                         void*,
+                         struct container__hash_bucket** restrict
+                        );
+
+/*
+    Mark a node in the cache as recently used according to the cache's policy
+
+    Syntax:
+        Container_TouchCacheNode(&my_element.cache_node, &my_cache);
+ */
+inline void
+Container_TouchCacheNode (
+                          struct container__cache_node* restrict,
+                          struct container__cache* restrict
+                         );
+
+
+/*
+    Add a node of the specified weight to the cache, first evicting nodes until it fits within
+    the cache's limits.  The node being added is never evicted by its own addition, so a node
+    heavier than the weight limit is added once every other node has been evicted
+
+    Syntax:
+        Container_AddCacheNode(value_hash, my_weight, &my_element.cache_node, &my_cache);
+ */
+inline void
+Container_AddCacheNode (
+                        unsigned int,
+                        size_t,
+                        struct container__cache_node* restrict,
+                        struct container__cache* restrict
+                       );
+
+/*
+    Add a node of the specified weight to the bucket returned by a failed lookup, evicting
+    nodes as with Container_AddCacheNode.  Evicting nodes leaves the bucket valid
+
+    Syntax:
+        Container_InsCacheNode(my_weight, &my_element.cache_node, searched_bucket, &my_cache);
+ */
+inline void
+Container_InsCacheNode (
+                        size_t,
+                        struct container__cache_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__cache* restrict
+                       );
+
+/*
+    Remove a node from the cache without passing it to the evict function
+
+    Syntax:
+        Container_RemoveCacheNode(&my_element.cache_node, &my_cache);
+ */
+inline void
+Container_RemoveCacheNode (
+                           struct container__cache_node* restrict,
+                           struct container__cache* restrict
+                          );
+
+/*
+    Evict the node chosen by the cache's policy, passing it to the evict function.  The cache
+    must be populated
+
+    Syntax:
+        Container_EvictCacheNode(&my_cache);
+ */
+inline void
+Container_EvictCacheNode (struct container__cache* restrict);
+
+/*
+    Change the limits of the cache, evicting nodes until the cache is within them
+
+    Syntax:
+        Container_SetCacheLimits(node_limit, weight_limit, &my_cache);
+ */
+inline void
+Container_SetCacheLimits (unsigned int, size_t, struct container__cache* restrict);
+
+
+/*
+    Return the state of the cache
+
+    Syntax:
+        state = Container_CacheState(&my_cache);
+ */
+inline enum container__cache_state
+Container_CacheState (struct container__cache* restrict);
+
+
+#include <container/utils.h>
+
+
+struct container__cache_hlist_lookup_data
+{
+    void*                        user_data;
+    container__cache_lookup_type lookup;
+};
+
+
+inline enum container__hlist_cmp_result
+Container_CacheHListLookup (void*, struct container__hlist_node* restrict, void*);
+
+inline struct container__cache_node*
+Container_CacheTail (struct container__cache* restrict);
+
+inline void
+Container_EvictCacheNodeOf (
+                            struct container__cache_node* restrict,
+                            struct container__cache* restrict
+                           );
+
+inline void
+Container_MakeCacheRoom (unsigned int, size_t, struct container__cache* restrict);
+
+
+inline enum container__hlist_cmp_result
+Container_CacheHListLookup (
+                            void*                                  value,
+                            struct container__hlist_node* restrict hlist_node,
+                            void*                                  user_data
+                           )
+{
+    struct container__cache_hlist_lookup_data* restrict cache_hlist_lookup;
+    struct container__cache_node*                       cache_node;
+    enum container__cache_cmp_result                    result;
+
+    cache_hlist_lookup = user_data;
+    cache_node         = CONTAINER__CONTAINER_OF(
+                                                 hlist_node,
+                                                 struct container__cache_node,
+                                                 node
+                                                );
+
+    result = (*cache_hlist_lookup->lookup)(value, cache_node, cache_hlist_lookup->user_data);
+    if(result == container__cache_node_not_equal)
+        return container__hlist_node_not_equal;
+
+    return container__hlist_node_equal;
+}
+
+inline struct container__cache_node*
+Container_CacheTail (struct container__cache* restrict cache)
+{
+    struct container__hlist_node* hlist_node;
+
+    hlist_node = CONTAINER__CONTAINER_OF(
+                                         cache->hlist.list.sentinel.prev,
+                                         struct container__hlist_node,
+                                         list_node
+                                        );
+
+    return CONTAINER__CONTAINER_OF(hlist_node, struct container__cache_node, node);
+}
+
+inline void
+Container_EvictCacheNodeOf (
+                            struct container__cache_node* restrict node,
+                            struct container__cache* restrict      cache
+                           )
+{
+    Container_RemoveCacheNode(node, cache);
+
+    cache->eviction_count++;
+
+    /*
+        The node is passed on last, as the evict function may release it
+     */
+    if(cache->evict != NULL)
+        (*cache->evict)(node, cache->user_data);
+}
+
+inline void
+Container_MakeCacheRoom (unsigned int count, size_t weight, struct container__cache* restrict cache)
+{
+    while(cache->node_count > 0)
+    {
+        if(
+           (cache->node_limit == 0 || cache->node_count+count <= cache->node_limit) &&
+           (cache->weight_limit == 0 || cache->weight+weight <= cache->weight_limit)
+          )
+        {
+            break;
+        }
+
+        Container_EvictCacheNode(cache);
+    }
+}
+
+
+inline enum container__error_code
+Container_CreateCache (
+                       unsigned int                      count,
+                       enum container__cache_policy      policy,
+                       unsigned int                      node_limit,
+                       size_t                            weight_limit,
+                       container__cache_evict_type       evict,
+                       void*                             user_data,
+                       struct container__cache* restrict cache
+                      )
+{
+    return Container_CreateCacheWithAllocator(
+                                              count,
+                                              policy,
+                                              node_limit,
+                                              weight_limit,
+                                              evict,
+                                              user_data,
+                                              NULL,
+                                              cache
+                                             );
+}
+
+inline enum container__error_code
+Container_CreateCacheWithAllocator (
+                                    unsigned int                       count,
+                                    enum container__cache_policy       policy,
+                                    unsigned int                       node_limit,
+                                    size_t                             weight_limit,
+                                    container__cache_evict_type        evict,
+                                    void*                              user_data,
+                                    const struct container__allocator* allocator,
+                                    struct container__cache* restrict  cache
+                                   )
+{
+    enum container__error_code error;
+
+    if(count == 0)
+        count = 1;
+
+    error = Container_CreateHashWithAllocator(
+                                              count,
+                                              container__hash_alloc_default,
+                                              allocator,
+                                              &cache->hlist.hash
+                                             );
+    if(error != container__error_none)
+        return error;
+
+    Container_InitCList(&cache->hlist.list);
+
+    cache->policy         = policy;
+    cache->node_count     = 0;
+    cache->node_limit     = node_limit;
+    cache->weight         = 0;
+    cache->weight_limit   = weight_limit;
+    cache->hit_count      = 0;
+    cache->miss_count     = 0;
+    cache->eviction_count = 0;
+    cache->evict          = evict;
+    cache->user_data      = user_data;
+    cache->allocator      = allocator;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyCache (struct container__cache* restrict cache)
+{
+    /*
+        Nodes are evicted from the tail without regard to the policy, as the order no longer
+        matters and a CLOCK sweep would relink every referenced node first
+     */
+    while(cache->node_count > 0)
+        Container_EvictCacheNodeOf(Container_CacheTail(cache), cache);
+
+    Container_DestroyHash(&cache->hlist.hash);
+}
+
+inline struct container__cache_node*
+Container_LookupCacheNode (
+                           unsigned int                             value_hash,
+                           void*                                    value,
+                           struct container__cache* restrict        cache,
+                           container__cache_lookup_type             lookup,
+                           void*                                    user_data,
+                           struct container__hash_bucket** restrict searched_bucket
+                          )
+{
+    struct container__cache_node* cache_node;
+
+    cache_node = Container_PeekCacheNode(
+                                         value_hash,
+                                         value,
+                                         cache,
+                                         lookup,
+                                         user_data,
+                                         searched_bucket
+                                        );
+    if(cache_node == NULL)
+    {
+        cache->miss_count++;
+
+        return NULL;
+    }
+
+    cache->hit_count++;
+
+    Container_TouchCacheNode(cache_node, cache);
+
+    return cache_node;
+}
+
+inline struct container__cache_node*
+Container_PeekCacheNode (
+                         unsigned int                             value_hash,
+                         void*                                    value,
+                         struct container__cache* restrict        cache,
+                         container__cache_lookup_type             lookup,
+                         void*                                    user_data,
+                         struct container__hash_bucket** restrict searched_bucket
+                        )
+{
+    struct container__cache_hlist_lookup_data cache_hlist_lookup;
+    struct container__hlist_node*             hlist_node;
+    struct container__cache_node*             cache_node;
+
+    cache_hlist_lookup.user_data = user_data;
+    cache_hlist_lookup.lookup    = lookup;
+
+    hlist_node = Container_LookupHListNode(
+                                           value_hash,
+                                           value,
+                                           &cache->hlist,
+                                           &Container_CacheHListLookup,
+                                           &cache_hlist_lookup,
+                                           searched_bucket
+                                          );
+    if(hlist_node == NULL)
+        return NULL;
+
+    cache_node = CONTAINER__CONTAINER_OF(hlist_node, struct container__cache_node, node);
+
+    return cache_node;
+}
+
+inline void
+Container_TouchCacheNode (
+                          struct container__cache_node* restrict node,
+                          struct container__cache* restrict      cache
+                         )
+{
+    if(cache->policy == container__cache_clock)
+    {
+        /*
+            The mark is only written when it changes, so hits on hot nodes don't dirty their
+            cache lines
+         */
+        if(node->referenced == 0)
+            node->referenced = 1;
+
+        return;
+    }
+
+    if(cache->hlist.list.sentinel.next != &node->node.list_node)
+    {
+        Container_RemoveCListNode(&node->node.list_node);
+        Container_AddCListHead(&node->node.list_node, &cache->hlist.list);
+    }
+}
+
+inline void
+Container_AddCacheNode (
+                        unsigned int                           value_hash,
+                        size_t                                 weight,
+                        struct container__cache_node* restrict node,
+                        struct container__cache* restrict      cache
+                       )
+{
+    Container_MakeCacheRoom(1, weight, cache);
+
+    node->weight     = weight;
+    node->referenced = 0;
+
+    Container_AddHListNode(value_hash, &node->node, &cache->hlist);
+
+    cache->node_count++;
+    cache->weight += weight;
+}
+
+inline void
+Container_InsCacheNode (
+                        size_t                                  weight,
+                        struct container__cache_node* restrict  node,
+                        struct container__hash_bucket* restrict bucket,
+                        struct container__cache* restrict       cache
+                       )
+{
+    Container_MakeCacheRoom(1, weight, cache);
+
+    node->weight     = weight;
+    node->referenced = 0;
+
+    Container_InsHListNode(&node->node, bucket, &cache->hlist);
+
+    cache->node_count++;
+    cache->weight += weight;
+}
+
+inline void
+Container_RemoveCacheNode (
+                           struct container__cache_node* restrict node,
+                           struct container__cache* restrict      cache
+                          )
+{
+    Container_RemoveHListNode(&node->node);
+
+    cache->node_count--;
+    cache->weight -= node->weight;
+}
+
+inline void
+Container_EvictCacheNode (struct container__cache* restrict cache)
+{
+    struct container__cache_node* victim;
+
+    victim = Container_CacheTail(cache);
+
+    if(cache->policy == container__cache_clock)
+    {
+        /*
+            Every referenced node passed over loses its mark, so the sweep ends within one pass
+            of the list
+         */
+        while(victim->referenced != 0)
+        {
+            victim->referenced = 0;
+
+            Container_RemoveCListNode(&victim->node.list_node);
+            Container_AddCListHead(&victim->node.list_node, &cache->hlist.list);
+
+            victim = Container_CacheTail(cache);
+        }
+    }
+
+    Container_EvictCacheNodeOf(victim, cache);
+}
+
+inline void
+Container_SetCacheLimits (
+                          unsigned int                      node_limit,
+                          size_t                            weight_limit,
+                          struct container__cache* restrict cache
+                         )
+{
+    cache->node_limit   = node_limit;
+    cache->weight_limit = weight_limit;
+
+    Container_MakeCacheRoom(0, 0, cache);
+}
+
+inline enum container__cache_state
+Container_CacheState (struct container__cache* restrict cache)
+{
+    if(cache->node_count == 0)
+        return container__cache_empty;
+
+    return container__cache_populated;
+}
+
+
+#endif
@@ -0,0 +1,679 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The chash container manages a compact hash of elements.  Each bucket is a single pointer
+    to the first node in the bucket, half the size of a hash bucket, and an empty bucket is
+    all zero so created buckets need not be written at all.  Each node tracks the pointer
+    which points to it, so nodes may still be removed without knowing their bucket
+ */
+
+
+#ifndef _CONTAINER__CHASH_H_
+#define _CONTAINER__CHASH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hash.h>
+
+
+/*
+    Valid states for a chash bucket
+ */
+enum container__chash_bucket_state
+{
+    container__chash_bucket_populated,
+    container__chash_bucket_empty
+};
+
+/*
+    Valid states for a scan of a chash bucket
+ */
+enum container__chash_bucket_scan_state
+{
+    container__chash_bucket_scan_incomplete,
+    container__chash_bucket_scan_finished
+};
+
+
+/*
+    The node data to be placed in each chash element
+
+    Accessible members:
+        next -- the next node in the bucket
+ */
+struct container__chash_node
+{
+    struct container__chash_node*  next;
+    struct container__chash_node** prev_next;
+};
+
+/*
+    The buckets which make up the chash container
+
+    Accessible members:
+        head -- the first node in the bucket
+ */
+struct container__chash_bucket
+{
+    struct container__chash_node* head;
+};
+
+/*
+    The chash container itself.  Buckets are selected as they are for the hash container
+
+    Accessible members:
+        allocator -- the allocator used for the buckets
+ */
+struct container__chash
+{
+    unsigned int                       bucket_count;
+    unsigned int                       index_shift;
+    struct container__chash_bucket*    buckets;
+    const struct container__allocator* allocator;
+};
+
+/*
+    The scan structure used to scan an individual chash bucket
+
+    Accessible members:
+        current_node -- the current element node being visited
+ */
+struct container__chash_bucket_scan
+{
+    struct container__chash_node* current_node;
+};
+
+
+/*
+    The required type for a user-defined chash lookup function
+
+    For example:
+        enum container__hash_cmp_result
+        MyLookup (
+                  void*                                  id_to_lookup,
+                  struct container__chash_node* restrict cmp_node,
+                  void*                                  user_data
+                 )
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(cmp_node, struct my_element, node);
+
+            if(element->my_id == *(my_id_type*)id_to_lookup)
+                return container__hash_node_equal;
+
+            return container__hash_node_not_equal;
+        }
+ */
+typedef enum container__hash_cmp_result
+(*container__chash_lookup_type) (
+                                 void*,
+                                 struct container__chash_node* restrict,
+                                 void*
+                                );
+
+
+/*
+     Initialize a chash.  The container will be empty upon initialization
+
+     Syntax:
+         Container_InitCHash(bucket_count, my_buckets_array, &my_chash);
+ */
+inline void
+Container_InitCHash (
+                     unsigned int,
+                     struct container__chash_bucket* restrict,
+                     struct container__chash* restrict
+                    );
+
+/*
+     Initialize a chash with a power of two number of buckets, specified as the base 2
+     logarithm of the bucket count, as with Container_InitHashShift.  The shift must be no
+     larger than CONTAINER__HASH_MAX_SHIFT, which is asserted
+
+     Syntax:
+         Container_InitCHashShift(bucket_shift, my_buckets_array, &my_chash);
+ */
+inline void
+Container_InitCHashShift (
+                          unsigned int,
+                          struct container__chash_bucket* restrict,
+                          struct container__chash* restrict
+                         );
+
+/*
+     Allocate chash buckets and initialize a chash.  The buckets are allocated already zeroed,
+     which for large chashes leaves the operating system to supply zero pages on first touch.
+     The container will be empty upon initialization
+
+     Syntax:
+         error = Container_CreateCHash(bucket_count, &my_chash);
+ */
+inline enum container__error_code
+Container_CreateCHash (unsigned int, struct container__chash* restrict);
+
+/*
+     Allocate a power of two number of chash buckets, specified as the base 2 logarithm of the
+     bucket count, and initialize a chash as with Container_InitCHashShift
+
+     Syntax:
+         error = Container_CreateCHashShift(bucket_shift, &my_chash);
+ */
+inline enum container__error_code
+Container_CreateCHashShift (unsigned int, struct container__chash* restrict);
+
+/*
+     Allocate chash buckets using an allocator and initialize a chash.  The buckets are
+     zeroed by the allocator interface rather than left to the operating system
+
+     Syntax:
+         error = Container_CreateCHashWithAllocator(bucket_count, &my_allocator, &my_chash);
+ */
+inline enum container__error_code
+Container_CreateCHashWithAllocator (
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__chash* restrict
+                                   );
+
+/*
+     Allocate a power of two number of chash buckets using an allocator, and initialize a
+     chash as with Container_InitCHashShift
+
+     Syntax:
+         error = Container_CreateCHashShiftWithAllocator(bucket_shift, &my_allocator, &my_chash);
+ */
+inline enum container__error_code
+Container_CreateCHashShiftWithAllocator (
+                                         unsigned int,
+                                         const struct container__allocator*,
+                                         struct container__chash* restrict
+                                        );
+
+/*
+     Cleanup a previously created chash
+
+     Syntax:
+         Container_DestroyCHash(&my_chash);
+ */
+inline void
+Container_DestroyCHash (struct container__chash* restrict);
+
+
+/*
+    Reset a chash container to the initialized state
+
+    Syntax:
+        Container_ResetCHash(&my_chash);
+ */
+inline void
+Container_ResetCHash (struct container__chash* restrict);
+
+/*
+    Reset one part of a chash, for callers which split up a reset across their own threads, as
+    with Container_ResetHashPart.  An empty chash bucket is all zero, so each part is cleared
+    as a single block of memory
+
+    Syntax:
+        Container_ResetCHashPart(thread_index, thread_count, &my_chash);
+ */
+inline void
+Container_ResetCHashPart (unsigned int, unsigned int, struct container__chash* restrict);
+
+/*
+    Reset a chash container to the initialized state, splitting the reset into parts as
+    described by the parallel structure
+
+    Syntax:
+        Container_ResetCHashParallel(&my_parallel, &my_chash);
+ */
+inline void
+Container_ResetCHashParallel (
+                              const struct container__hash_parallel*,
+                              struct container__chash* restrict
+                             );
+
+
+/*
+   Lookup the bucket which maps to the specified hash value
+
+   Syntax:
+     found_bucket = Container_LookupCHashBucket(value, &my_chash);
+ */
+inline struct container__chash_bucket*
+Container_LookupCHashBucket (unsigned int, struct container__chash* restrict);
+
+/*
+    Lookup a node in the chash.  Upon completion, the bucket searched for the node will be
+    set and the found node returned.  If no node was found, NULL is returned
+
+    Syntax:
+        found_node = Container_LookupCHashNode(
+                                               MyHashValue(lookup_id),
+                                               &lookup_id,
+                                               &my_chash,
+                                               &MyLookup,
+                                               my_user_data,
+                                               &searched_bucket
+                                              );
+ */
+inline struct container__chash_node*
+Container_LookupCHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__chash* restrict,
+                           container__chash_lookup_type,
+                           void*,
+                           struct container__chash_bucket** restrict
+                          );
+
+
+/*
+     Add a node to the chash, specifying the hash value for the node
+
+     Syntax:
+         Container_AddCHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_chash);
+ */
+inline void
+Container_AddCHashNode (
+                        unsigned int,
+                        struct container__chash_node* restrict,
+                        struct container__chash* restrict
+                       );
+
+/*
+    Insert a node into the specified chash bucket
+
+    Syntax:
+        Container_InsCHashNode(&my_element.node, &my_chash_bucket);
+ */
+inline void
+Container_InsCHashNode (
+                        struct container__chash_node* restrict,
+                        struct container__chash_bucket* restrict
+                       );
+
+/*
+    Remove a node from the chash
+
+    Syntax:
+        Container_RemoveCHashNode(&my_element.node);
+ */
+inline void
+Container_RemoveCHashNode (struct container__chash_node* restrict);
+
+
+/*
+    Return the state of a chash bucket
+
+    Syntax:
+        bucket_state = Container_CHashBucketState(&my_chash_bucket);
+ */
+inline enum container__chash_bucket_state
+Container_CHashBucketState (struct container__chash_bucket* restrict);
+
+
+/*
+    Start a scan of a particular chash bucket
+
+    Syntax:
+        Container_StartCHashBucketScan(&my_buckets[scan_bucket_index], &bucket_scan);
+ */
+inline void
+Container_StartCHashBucketScan (
+                                struct container__chash_bucket* restrict,
+                                struct container__chash_bucket_scan* restrict
+                               );
+
+/*
+    Resume a scan of a chash bucket.  The node most recently visited may be removed before
+    resuming only if its next member is saved and restored as the current node instead
+
+    Syntax:
+        Container_ResumeCHashBucketScan(&bucket_scan);
+ */
+inline void
+Container_ResumeCHashBucketScan (struct container__chash_bucket_scan* restrict);
+
+/*
+    Return the state of a chash bucket scan
+
+    Syntax:
+        scan_state = Container_CHashBucketScanState(&bucket_scan);
+ */
+inline enum container__chash_bucket_scan_state
+Container_CHashBucketScanState (struct container__chash_bucket_scan* restrict);
+
+
+#include <container/utils.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*
+    The part data passed to Container_ResetCHashTask
+ */
+struct container__chash_reset_task
+{
+    unsigned int             part_count;
+    struct container__chash* chash;
+};
+
+
+inline void
+Container_ResetCHashTask (unsigned int, void*);
+
+inline unsigned int
+Container_CHashBucketIndex (unsigned int, struct container__chash* restrict);
+
+
+inline void
+Container_ResetCHashTask (unsigned int part_index, void* part_data)
+{
+    struct container__chash_reset_task* task;
+
+    task = part_data;
+
+    Container_ResetCHashPart(part_index, task->part_count, task->chash);
+}
+
+
+inline unsigned int
+Container_CHashBucketIndex (unsigned int value_hash, struct container__chash* restrict chash)
+{
+    uint32_t mixed_hash;
+
+    if(chash->index_shift == 0)
+        return value_hash%chash->bucket_count;
+
+    mixed_hash = (uint32_t)value_hash*CONTAINER__HASH_MULTIPLIER;
+
+    return mixed_hash>>chash->index_shift;
+}
+
+
+inline void
+Container_InitCHash (
+                     unsigned int                             count,
+                     struct container__chash_bucket* restrict buckets,
+                     struct container__chash* restrict        chash
+                    )
+{
+    chash->bucket_count = count;
+    chash->index_shift  = 0;
+    chash->buckets      = buckets;
+    chash->allocator    = NULL;
+
+    Container_ResetCHash(chash);
+}
+
+inline void
+Container_InitCHashShift (
+                          unsigned int                             shift,
+                          struct container__chash_bucket* restrict buckets,
+                          struct container__chash* restrict        chash
+                         )
+{
+    assert(shift <= CONTAINER__HASH_MAX_SHIFT);
+
+    Container_InitCHash(1u<<shift, buckets, chash);
+
+    if(shift > 0)
+        chash->index_shift = 32-shift;
+}
+
+inline enum container__error_code
+Container_CreateCHash (unsigned int count, struct container__chash* restrict chash)
+{
+    return Container_CreateCHashWithAllocator(count, NULL, chash);
+}
+
+inline enum container__error_code
+Container_CreateCHashShift (unsigned int shift, struct container__chash* restrict chash)
+{
+    return Container_CreateCHashShiftWithAllocator(shift, NULL, chash);
+}
+
+inline enum container__error_code
+Container_CreateCHashWithAllocator (
+                                    unsigned int                       count,
+                                    const struct container__allocator* allocator,
+                                    struct container__chash* restrict  chash
+                                   )
+{
+    struct container__chash_bucket* buckets;
+
+    buckets = Container_AllocZeroMemory(sizeof(struct container__chash_bucket)*count, allocator);
+    if(buckets == NULL)
+        return container__error_memory_alloc;
+
+    chash->bucket_count = count;
+    chash->index_shift  = 0;
+    chash->buckets      = buckets;
+    chash->allocator    = allocator;
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_CreateCHashShiftWithAllocator (
+                                         unsigned int                       shift,
+                                         const struct container__allocator* allocator,
+                                         struct container__chash* restrict  chash
+                                        )
+{
+    enum container__error_code error;
+
+    if(shift > CONTAINER__HASH_MAX_SHIFT)
+        return container__error_resource_unavailable;
+
+    error = Container_CreateCHashWithAllocator(1u<<shift, allocator, chash);
+    if(error != container__error_none)
+        return error;
+
+    if(shift > 0)
+        chash->index_shift = 32-shift;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyCHash (struct container__chash* restrict chash)
+{
+    Container_FreeMemory(
+                         chash->buckets,
+                         sizeof(struct container__chash_bucket)*chash->bucket_count,
+                         chash->allocator
+                        );
+}
+
+inline void
+Container_ResetCHash (struct container__chash* restrict chash)
+{
+    Container_ResetCHashPart(0, 1, chash);
+}
+
+inline void
+Container_ResetCHashPart (
+                          unsigned int                      part_index,
+                          unsigned int                      part_count,
+                          struct container__chash* restrict chash
+                         )
+{
+    unsigned int index;
+    unsigned int end;
+
+    index = (unsigned int)((unsigned long long)chash->bucket_count*part_index/part_count);
+    end   = (unsigned int)((unsigned long long)chash->bucket_count*(part_index+1)/part_count);
+
+    memset(&chash->buckets[index], 0, sizeof(struct container__chash_bucket)*(end-index));
+}
+
+inline void
+Container_ResetCHashParallel (
+                              const struct container__hash_parallel* parallel,
+                              struct container__chash* restrict      chash
+                             )
+{
+    struct container__chash_reset_task task;
+
+    if(parallel == NULL || parallel->part_count <= 1)
+    {
+        Container_ResetCHash(chash);
+
+        return;
+    }
+
+    task.part_count = parallel->part_count;
+    task.chash      = chash;
+
+    (*parallel->run_parts)(
+                           parallel->part_count,
+                           &Container_ResetCHashTask,
+                           &task,
+                           parallel->user_data
+                          );
+}
+
+inline struct container__chash_bucket*
+Container_LookupCHashBucket (unsigned int value_hash, struct container__chash* restrict chash)
+{
+    struct container__chash_bucket* chash_bucket;
+
+    chash_bucket = &chash->buckets[Container_CHashBucketIndex(value_hash, chash)];
+
+    return chash_bucket;
+}
+
+inline struct container__chash_node*
+Container_LookupCHashNode (
+                           unsigned int                              value_hash,
+                           void*                                     value,
+                           struct container__chash* restrict         chash,
+                           container__chash_lookup_type              lookup,
+                           void*                                     user_data,
+                           struct container__chash_bucket** restrict searched_bucket
+                          )
+{
+    struct container__chash_bucket* chash_bucket;
+    struct container__chash_node*   node;
+
+    chash_bucket     = Container_LookupCHashBucket(value_hash, chash);
+    *searched_bucket = chash_bucket;
+
+    for(node = chash_bucket->head; node != NULL; node = node->next)
+    {
+        enum container__hash_cmp_result result;
+
+        result = (*lookup)(value, node, user_data);
+        if(result == container__hash_node_equal)
+            return node;
+    }
+
+    return NULL;
+}
+
+inline void
+Container_AddCHashNode (
+                        unsigned int                           value_hash,
+                        struct container__chash_node* restrict node,
+                        struct container__chash* restrict      chash
+                       )
+{
+    struct container__chash_bucket* chash_bucket;
+
+    chash_bucket = Container_LookupCHashBucket(value_hash, chash);
+
+    Container_InsCHashNode(node, chash_bucket);
+}
+
+inline void
+Container_InsCHashNode (
+                        struct container__chash_node* restrict   node,
+                        struct container__chash_bucket* restrict bucket
+                       )
+{
+    struct container__chash_node* head;
+
+    head = bucket->head;
+
+    node->next      = head;
+    node->prev_next = &bucket->head;
+
+    if(head != NULL)
+        head->prev_next = &node->next;
+
+    bucket->head = node;
+}
+
+inline void
+Container_RemoveCHashNode (struct container__chash_node* restrict node)
+{
+    struct container__chash_node* next;
+
+    next = node->next;
+
+    *node->prev_next = next;
+    if(next != NULL)
+        next->prev_next = node->prev_next;
+}
+
+inline enum container__chash_bucket_state
+Container_CHashBucketState (struct container__chash_bucket* restrict bucket)
+{
+    if(bucket->head == NULL)
+        return container__chash_bucket_empty;
+
+    return container__chash_bucket_populated;
+}
+
+inline void
+Container_StartCHashBucketScan (
+                                struct container__chash_bucket* restrict      bucket,
+                                struct container__chash_bucket_scan* restrict scan
+                               )
+{
+    scan->current_node = bucket->head;
+}
+
+inline void
+Container_ResumeCHashBucketScan (struct container__chash_bucket_scan* restrict scan)
+{
+    scan->current_node = scan->current_node->next;
+}
+
+inline enum container__chash_bucket_scan_state
+Container_CHashBucketScanState (struct container__chash_bucket_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__chash_bucket_scan_finished;
+
+    return container__chash_bucket_scan_incomplete;
+}
+
+
+#endif
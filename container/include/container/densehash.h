@@ -0,0 +1,1149 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The dense hash containers map unsigned int or unsigned long long keys to nodes using open
+    addressing with linear probing.  Each slot holds a key along with a pointer to its node,
+    and a slot is 16 bytes on 64 bit targets, so four slots share a cache line.  A lookup
+    compares keys within the table itself, probing neighbouring slots until it finds the key
+    or an empty slot, and never reads a node it doesn't return.  Removed keys are closed up by
+    shifting later keys of the same run back, so no deleted markers are left behind to lengthen
+    later probes.
+
+    The dense hashes store pointers to nodes placed in each element, rather than the elements
+    themselves, so elements never move as a dense hash grows
+ */
+
+
+#ifndef _CONTAINER__DENSEHASH_H_
+#define _CONTAINER__DENSEHASH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hash.h>
+
+
+/*
+    Valid states for a scan of a dense hash
+ */
+enum container__dense_hash_scan_state
+{
+    container__dense_hash_scan_incomplete,
+    container__dense_hash_scan_finished
+};
+
+
+/*
+    The result of probing a dense hash for a key, used to insert a node following a failed
+    lookup without probing again
+ */
+struct container__dense_hash_probe
+{
+    unsigned int slot;
+};
+
+/*
+    The node data to be placed in each element of a uint dense hash
+
+    Accessible members:
+        value -- the key the node was added with
+ */
+struct container__dense_uint_hash_node
+{
+    unsigned int value;
+};
+
+/*
+    A slot of a uint dense hash.  The slot is empty when its node is NULL
+ */
+struct container__dense_uint_hash_slot
+{
+    unsigned int                            value;
+    struct container__dense_uint_hash_node* node;
+};
+
+/*
+    The uint dense hash container itself
+
+    Accessible members:
+        node_count -- the number of nodes currently in the dense hash
+        allocator  -- the allocator used for the slots
+ */
+struct container__dense_uint_hash
+{
+    unsigned int node_count;
+    unsigned int growth_left;
+
+    unsigned int slot_mask;
+    unsigned int index_shift;
+
+    struct container__dense_uint_hash_slot* slots;
+    void*                                   alloc_address;
+    const struct container__allocator*      allocator;
+};
+
+/*
+    The scan structure used to scan every node in a uint dense hash
+
+    Accessible members:
+        current_node -- the current element node being visited
+ */
+struct container__dense_uint_hash_scan
+{
+    struct container__dense_uint_hash_node* current_node;
+
+    unsigned int slot;
+};
+
+/*
+    The node data to be placed in each element of a ulong dense hash
+
+    Accessible members:
+        value -- the key the node was added with
+ */
+struct container__dense_ulong_hash_node
+{
+    unsigned long long value;
+};
+
+/*
+    A slot of a ulong dense hash.  The slot is empty when its node is NULL
+ */
+struct container__dense_ulong_hash_slot
+{
+    unsigned long long                       value;
+    struct container__dense_ulong_hash_node* node;
+};
+
+/*
+    The ulong dense hash container itself
+
+    Accessible members:
+        node_count -- the number of nodes currently in the dense hash
+        allocator  -- the allocator used for the slots
+ */
+struct container__dense_ulong_hash
+{
+    unsigned int node_count;
+    unsigned int growth_left;
+
+    unsigned int slot_mask;
+    unsigned int index_shift;
+
+    struct container__dense_ulong_hash_slot* slots;
+    void*                                    alloc_address;
+    const struct container__allocator*       allocator;
+};
+
+/*
+    The scan structure used to scan every node in a ulong dense hash
+
+    Accessible members:
+        current_node -- the current element node being visited
+ */
+struct container__dense_ulong_hash_scan
+{
+    struct container__dense_ulong_hash_node* current_node;
+
+    unsigned int slot;
+};
+
+
+/*
+    Allocate the slots for and initialize a uint dense hash able to hold the specified number
+    of nodes before growing.  The container will be empty upon initialization
+
+    Syntax:
+        error = Container_CreateDenseUIntHash(expected_node_count, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_CreateDenseUIntHash (unsigned int, struct container__dense_uint_hash* restrict);
+
+/*
+    Allocate the slots for and initialize a uint dense hash as with
+    Container_CreateDenseUIntHash, using an allocator.  The allocator is also used as the dense
+    hash grows
+
+    Syntax:
+        error = Container_CreateDenseUIntHashWithAllocator(
+                                                           expected_node_count,
+                                                           &my_allocator,
+                                                           &my_dense_hash
+                                                          );
+ */
+inline enum container__error_code
+Container_CreateDenseUIntHashWithAllocator (
+                                            unsigned int,
+                                            const struct container__allocator*,
+                                            struct container__dense_uint_hash* restrict
+                                           );
+
+/*
+    Cleanup a previously created uint dense hash
+
+    Syntax:
+        Container_DestroyDenseUIntHash(&my_dense_hash);
+ */
+inline void
+Container_DestroyDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+/*
+    Reset a uint dense hash to the initialized state
+
+    Syntax:
+        Container_ResetDenseUIntHash(&my_dense_hash);
+ */
+inline void
+Container_ResetDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+
+/*
+    Lookup a key in a uint dense hash.  Upon completion, the probe will be set for use with
+    Container_InsDenseUIntHash and the found node returned.  If no node was found, NULL is
+    returned
+
+    Syntax:
+        found_node = Container_LookupDenseUIntHash(lookup_key, &my_dense_hash, &probe);
+ */
+inline struct container__dense_uint_hash_node*
+Container_LookupDenseUIntHash (
+                               unsigned int,
+                               struct container__dense_uint_hash* restrict,
+                               struct container__dense_hash_probe* restrict
+                              );
+
+/*
+    Add a node to a uint dense hash with the specified key.  An error is returned should the
+    dense hash need to grow and allocating more slots fail
+
+    Syntax:
+        error = Container_AddDenseUIntHash(my_key, &my_element.node, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_AddDenseUIntHash (
+                            unsigned int,
+                            struct container__dense_uint_hash_node* restrict,
+                            struct container__dense_uint_hash* restrict
+                           );
+
+/*
+    Insert a node with the specified key using the probe from a failed lookup of that key.
+    The dense hash must not have been modified since the lookup.  An error is returned should
+    the dense hash need to grow and allocating more slots fail
+
+    Syntax:
+        error = Container_InsDenseUIntHash(my_key, &my_element.node, &probe, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_InsDenseUIntHash (
+                            unsigned int,
+                            struct container__dense_uint_hash_node* restrict,
+                            struct container__dense_hash_probe* restrict,
+                            struct container__dense_uint_hash* restrict
+                           );
+
+/*
+    Remove a node from a uint dense hash.  Nodes later in the same run of slots are moved back
+    to close the gap
+
+    Syntax:
+        Container_RemoveDenseUIntHash(&my_element.node, &my_dense_hash);
+ */
+inline void
+Container_RemoveDenseUIntHash (
+                               struct container__dense_uint_hash_node* restrict,
+                               struct container__dense_uint_hash* restrict
+                              );
+
+
+/*
+    Start a scan of every node in a uint dense hash.  Nodes may not be added or removed during
+    a scan, since either may move nodes between slots
+
+    Syntax:
+        Container_StartDenseUIntHashScan(&my_dense_hash, &scan);
+ */
+inline void
+Container_StartDenseUIntHashScan (
+                                  struct container__dense_uint_hash* restrict,
+                                  struct container__dense_uint_hash_scan* restrict
+                                 );
+
+/*
+    Resume a scan of a uint dense hash
+
+    Syntax:
+        Container_ResumeDenseUIntHashScan(&my_dense_hash, &scan);
+ */
+inline void
+Container_ResumeDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict,
+                                   struct container__dense_uint_hash_scan* restrict
+                                  );
+
+/*
+    Return the state of a uint dense hash scan
+
+    Syntax:
+        scan_state = Container_DenseUIntHashScanState(&scan);
+ */
+inline enum container__dense_hash_scan_state
+Container_DenseUIntHashScanState (struct container__dense_uint_hash_scan* restrict);
+
+
+/*
+    Allocate the slots for and initialize a ulong dense hash able to hold the specified number
+    of nodes before growing.  The container will be empty upon initialization
+
+    Syntax:
+        error = Container_CreateDenseULongHash(expected_node_count, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_CreateDenseULongHash (unsigned int, struct container__dense_ulong_hash* restrict);
+
+/*
+    Allocate the slots for and initialize a ulong dense hash as with
+    Container_CreateDenseULongHash, using an allocator.  The allocator is also used as the dense
+    hash grows
+
+    Syntax:
+        error = Container_CreateDenseULongHashWithAllocator(
+                                                            expected_node_count,
+                                                            &my_allocator,
+                                                            &my_dense_hash
+                                                           );
+ */
+inline enum container__error_code
+Container_CreateDenseULongHashWithAllocator (
+                                             unsigned int,
+                                             const struct container__allocator*,
+                                             struct container__dense_ulong_hash* restrict
+                                            );
+
+/*
+    Cleanup a previously created ulong dense hash
+
+    Syntax:
+        Container_DestroyDenseULongHash(&my_dense_hash);
+ */
+inline void
+Container_DestroyDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+/*
+    Reset a ulong dense hash to the initialized state
+
+    Syntax:
+        Container_ResetDenseULongHash(&my_dense_hash);
+ */
+inline void
+Container_ResetDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+
+/*
+    Lookup a key in a ulong dense hash.  Upon completion, the probe will be set for use with
+    Container_InsDenseULongHash and the found node returned.  If no node was found, NULL is
+    returned
+
+    Syntax:
+        found_node = Container_LookupDenseULongHash(lookup_key, &my_dense_hash, &probe);
+ */
+inline struct container__dense_ulong_hash_node*
+Container_LookupDenseULongHash (
+                                unsigned long long,
+                                struct container__dense_ulong_hash* restrict,
+                                struct container__dense_hash_probe* restrict
+                               );
+
+/*
+    Add a node to a ulong dense hash with the specified key.  An error is returned should the
+    dense hash need to grow and allocating more slots fail
+
+    Syntax:
+        error = Container_AddDenseULongHash(my_key, &my_element.node, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_AddDenseULongHash (
+                             unsigned long long,
+                             struct container__dense_ulong_hash_node* restrict,
+                             struct container__dense_ulong_hash* restrict
+                            );
+
+/*
+    Insert a node with the specified key using the probe from a failed lookup of that key.
+    The dense hash must not have been modified since the lookup.  An error is returned should
+    the dense hash need to grow and allocating more slots fail
+
+    Syntax:
+        error = Container_InsDenseULongHash(my_key, &my_element.node, &probe, &my_dense_hash);
+ */
+inline enum container__error_code
+Container_InsDenseULongHash (
+                             unsigned long long,
+                             struct container__dense_ulong_hash_node* restrict,
+                             struct container__dense_hash_probe* restrict,
+                             struct container__dense_ulong_hash* restrict
+                            );
+
+/*
+    Remove a node from a ulong dense hash.  Nodes later in the same run of slots are moved back
+    to close the gap
+
+    Syntax:
+        Container_RemoveDenseULongHash(&my_element.node, &my_dense_hash);
+ */
+inline void
+Container_RemoveDenseULongHash (
+                                struct container__dense_ulong_hash_node* restrict,
+                                struct container__dense_ulong_hash* restrict
+                               );
+
+
+/*
+    Start a scan of every node in a ulong dense hash.  Nodes may not be added or removed during
+    a scan, since either may move nodes between slots
+
+    Syntax:
+        Container_StartDenseULongHashScan(&my_dense_hash, &scan);
+ */
+inline void
+Container_StartDenseULongHashScan (
+                                   struct container__dense_ulong_hash* restrict,
+                                   struct container__dense_ulong_hash_scan* restrict
+                                  );
+
+/*
+    Resume a scan of a ulong dense hash
+
+    Syntax:
+        Container_ResumeDenseULongHashScan(&my_dense_hash, &scan);
+ */
+inline void
+Container_ResumeDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict,
+                                    struct container__dense_ulong_hash_scan* restrict
+                                   );
+
+/*
+    Return the state of a ulong dense hash scan
+
+    Syntax:
+        scan_state = Container_DenseULongHashScanState(&scan);
+ */
+inline enum container__dense_hash_scan_state
+Container_DenseULongHashScanState (struct container__dense_ulong_hash_scan* restrict);
+
+
+#include <container/hashfn.h>
+#include <container/utils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define CONTAINER__DENSE_HASH_MIN_SHIFT 3
+#define CONTAINER__DENSE_HASH_MAX_SHIFT 30
+
+
+inline unsigned int
+Container_DenseUIntHashHome (unsigned int, struct container__dense_uint_hash* restrict);
+
+inline unsigned int
+Container_FindDenseUIntHashSlot (unsigned int, struct container__dense_uint_hash* restrict);
+
+inline enum container__error_code
+Container_AllocDenseUIntHash (unsigned int, struct container__dense_uint_hash* restrict);
+
+inline enum container__error_code
+Container_GrowDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+inline void
+Container_UpdateDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict,
+                                   struct container__dense_uint_hash_scan* restrict
+                                  );
+
+inline unsigned int
+Container_DenseULongHashHome (unsigned long long, struct container__dense_ulong_hash* restrict);
+
+inline unsigned int
+Container_FindDenseULongHashSlot (unsigned long long, struct container__dense_ulong_hash* restrict);
+
+inline enum container__error_code
+Container_AllocDenseULongHash (unsigned int, struct container__dense_ulong_hash* restrict);
+
+inline enum container__error_code
+Container_GrowDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+inline void
+Container_UpdateDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict,
+                                    struct container__dense_ulong_hash_scan* restrict
+                                   );
+
+
+inline unsigned int
+Container_DenseUIntHashHome (
+                             unsigned int                                value,
+                             struct container__dense_uint_hash* restrict dense_hash
+                            )
+{
+    return Container_HashUInt(value)>>dense_hash->index_shift;
+}
+
+inline unsigned int
+Container_FindDenseUIntHashSlot (
+                                 unsigned int                                value,
+                                 struct container__dense_uint_hash* restrict dense_hash
+                                )
+{
+    unsigned int slot;
+
+    slot = Container_DenseUIntHashHome(value, dense_hash);
+    while(dense_hash->slots[slot].node != NULL)
+        slot = (slot+1)&dense_hash->slot_mask;
+
+    return slot;
+}
+
+inline enum container__error_code
+Container_AllocDenseUIntHash (
+                              unsigned int                                shift,
+                              struct container__dense_uint_hash* restrict dense_hash
+                             )
+{
+    char*        address;
+    size_t       alloc_size;
+    unsigned int capacity;
+
+    if(shift > CONTAINER__DENSE_HASH_MAX_SHIFT)
+        return container__error_resource_unavailable;
+
+    /*
+        The slots are aligned to a cache line so that no slot straddles two lines
+     */
+    capacity   = 1u<<shift;
+    alloc_size = sizeof(struct container__dense_uint_hash_slot)*(size_t)capacity+
+                 CONTAINER__HASH_CACHE_LINE_SIZE-1;
+    address    = Container_AllocMemory(alloc_size, dense_hash->allocator);
+    if(address == NULL)
+        return container__error_memory_alloc;
+
+    dense_hash->slots         = (void*)(((uintptr_t)address+CONTAINER__HASH_CACHE_LINE_SIZE-1)&
+                                        ~(uintptr_t)(CONTAINER__HASH_CACHE_LINE_SIZE-1));
+    dense_hash->alloc_address = address;
+    dense_hash->slot_mask     = capacity-1;
+    dense_hash->index_shift   = 32-shift;
+
+    Container_ResetDenseUIntHash(dense_hash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_GrowDenseUIntHash (struct container__dense_uint_hash* restrict dense_hash)
+{
+    struct container__dense_uint_hash old_dense_hash;
+    enum container__error_code        error;
+    unsigned int                      shift;
+
+    old_dense_hash = *dense_hash;
+    shift          = 33-old_dense_hash.index_shift;
+
+    error = Container_AllocDenseUIntHash(shift, dense_hash);
+    if(error != container__error_none)
+    {
+        *dense_hash = old_dense_hash;
+
+        return error;
+    }
+
+    for(unsigned int slot = 0; slot <= old_dense_hash.slot_mask; slot++)
+    {
+        struct container__dense_uint_hash_slot* old_slot;
+        unsigned int                            new_slot;
+
+        old_slot = &old_dense_hash.slots[slot];
+        if(old_slot->node == NULL)
+            continue;
+
+        new_slot = Container_FindDenseUIntHashSlot(old_slot->value, dense_hash);
+
+        dense_hash->slots[new_slot] = *old_slot;
+    }
+
+    dense_hash->node_count   = old_dense_hash.node_count;
+    dense_hash->growth_left -= old_dense_hash.node_count;
+
+    Container_DestroyDenseUIntHash(&old_dense_hash);
+
+    return container__error_none;
+}
+
+inline void
+Container_UpdateDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict      dense_hash,
+                                   struct container__dense_uint_hash_scan* restrict scan
+                                  )
+{
+    unsigned int slot;
+
+    for(slot = scan->slot; slot <= dense_hash->slot_mask; slot++)
+    {
+        if(dense_hash->slots[slot].node != NULL)
+        {
+            scan->slot         = slot;
+            scan->current_node = dense_hash->slots[slot].node;
+
+            return;
+        }
+    }
+
+    scan->slot         = dense_hash->slot_mask+1;
+    scan->current_node = NULL;
+}
+
+inline unsigned int
+Container_DenseULongHashHome (
+                              unsigned long long                           value,
+                              struct container__dense_ulong_hash* restrict dense_hash
+                             )
+{
+    return Container_HashULong(value)>>dense_hash->index_shift;
+}
+
+inline unsigned int
+Container_FindDenseULongHashSlot (
+                                  unsigned long long                           value,
+                                  struct container__dense_ulong_hash* restrict dense_hash
+                                 )
+{
+    unsigned int slot;
+
+    slot = Container_DenseULongHashHome(value, dense_hash);
+    while(dense_hash->slots[slot].node != NULL)
+        slot = (slot+1)&dense_hash->slot_mask;
+
+    return slot;
+}
+
+inline enum container__error_code
+Container_AllocDenseULongHash (
+                               unsigned int                                 shift,
+                               struct container__dense_ulong_hash* restrict dense_hash
+                              )
+{
+    char*        address;
+    size_t       alloc_size;
+    unsigned int capacity;
+
+    if(shift > CONTAINER__DENSE_HASH_MAX_SHIFT)
+        return container__error_resource_unavailable;
+
+    /*
+        The slots are aligned to a cache line so that no slot straddles two lines
+     */
+    capacity   = 1u<<shift;
+    alloc_size = sizeof(struct container__dense_ulong_hash_slot)*(size_t)capacity+
+                 CONTAINER__HASH_CACHE_LINE_SIZE-1;
+    address    = Container_AllocMemory(alloc_size, dense_hash->allocator);
+    if(address == NULL)
+        return container__error_memory_alloc;
+
+    dense_hash->slots         = (void*)(((uintptr_t)address+CONTAINER__HASH_CACHE_LINE_SIZE-1)&
+                                        ~(uintptr_t)(CONTAINER__HASH_CACHE_LINE_SIZE-1));
+    dense_hash->alloc_address = address;
+    dense_hash->slot_mask     = capacity-1;
+    dense_hash->index_shift   = 32-shift;
+
+    Container_ResetDenseULongHash(dense_hash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_GrowDenseULongHash (struct container__dense_ulong_hash* restrict dense_hash)
+{
+    struct container__dense_ulong_hash old_dense_hash;
+    enum container__error_code         error;
+    unsigned int                       shift;
+
+    old_dense_hash = *dense_hash;
+    shift          = 33-old_dense_hash.index_shift;
+
+    error = Container_AllocDenseULongHash(shift, dense_hash);
+    if(error != container__error_none)
+    {
+        *dense_hash = old_dense_hash;
+
+        return error;
+    }
+
+    for(unsigned int slot = 0; slot <= old_dense_hash.slot_mask; slot++)
+    {
+        struct container__dense_ulong_hash_slot* old_slot;
+        unsigned int                             new_slot;
+
+        old_slot = &old_dense_hash.slots[slot];
+        if(old_slot->node == NULL)
+            continue;
+
+        new_slot = Container_FindDenseULongHashSlot(old_slot->value, dense_hash);
+
+        dense_hash->slots[new_slot] = *old_slot;
+    }
+
+    dense_hash->node_count   = old_dense_hash.node_count;
+    dense_hash->growth_left -= old_dense_hash.node_count;
+
+    Container_DestroyDenseULongHash(&old_dense_hash);
+
+    return container__error_none;
+}
+
+inline void
+Container_UpdateDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict      dense_hash,
+                                    struct container__dense_ulong_hash_scan* restrict scan
+                                   )
+{
+    unsigned int slot;
+
+    for(slot = scan->slot; slot <= dense_hash->slot_mask; slot++)
+    {
+        if(dense_hash->slots[slot].node != NULL)
+        {
+            scan->slot         = slot;
+            scan->current_node = dense_hash->slots[slot].node;
+
+            return;
+        }
+    }
+
+    scan->slot         = dense_hash->slot_mask+1;
+    scan->current_node = NULL;
+}
+
+
+inline enum container__error_code
+Container_CreateDenseUIntHash (
+                               unsigned int                                count,
+                               struct container__dense_uint_hash* restrict dense_hash
+                              )
+{
+    return Container_CreateDenseUIntHashWithAllocator(count, NULL, dense_hash);
+}
+
+inline enum container__error_code
+Container_CreateDenseUIntHashWithAllocator (
+                                            unsigned int                                count,
+                                            const struct container__allocator*          allocator,
+                                            struct container__dense_uint_hash* restrict dense_hash
+                                           )
+{
+    unsigned int shift;
+
+    dense_hash->allocator = allocator;
+
+    shift = CONTAINER__DENSE_HASH_MIN_SHIFT;
+    while(shift < CONTAINER__DENSE_HASH_MAX_SHIFT && (1u<<shift)/4*3 < count)
+        shift++;
+
+    return Container_AllocDenseUIntHash(shift, dense_hash);
+}
+
+inline void
+Container_DestroyDenseUIntHash (struct container__dense_uint_hash* restrict dense_hash)
+{
+    size_t alloc_size;
+
+    alloc_size = sizeof(struct container__dense_uint_hash_slot)*((size_t)dense_hash->slot_mask+1)+
+                 CONTAINER__HASH_CACHE_LINE_SIZE-1;
+
+    Container_FreeMemory(dense_hash->alloc_address, alloc_size, dense_hash->allocator);
+}
+
+inline void
+Container_ResetDenseUIntHash (struct container__dense_uint_hash* restrict dense_hash)
+{
+    for(unsigned int slot = 0; slot <= dense_hash->slot_mask; slot++)
+        dense_hash->slots[slot].node = NULL;
+
+    /*
+        Linear probing degrades quickly as the table fills, so the dense hash grows once three
+        quarters of its slots are in use
+     */
+    dense_hash->node_count  = 0;
+    dense_hash->growth_left = (dense_hash->slot_mask+1)/4*3;
+}
+
+inline struct container__dense_uint_hash_node*
+Container_LookupDenseUIntHash (
+                               unsigned int                                 value,
+                               struct container__dense_uint_hash* restrict  dense_hash,
+                               struct container__dense_hash_probe* restrict probe
+                              )
+{
+    unsigned int slot;
+
+    slot = Container_DenseUIntHashHome(value, dense_hash);
+
+    for(;;)
+    {
+        struct container__dense_uint_hash_slot* current;
+
+        current = &dense_hash->slots[slot];
+        if(current->node == NULL)
+            break;
+
+        if(current->value == value)
+            return current->node;
+
+        slot = (slot+1)&dense_hash->slot_mask;
+    }
+
+    probe->slot = slot;
+
+    return NULL;
+}
+
+inline enum container__error_code
+Container_AddDenseUIntHash (
+                            unsigned int                                     value,
+                            struct container__dense_uint_hash_node* restrict node,
+                            struct container__dense_uint_hash* restrict      dense_hash
+                           )
+{
+    struct container__dense_hash_probe probe;
+
+    probe.slot = Container_FindDenseUIntHashSlot(value, dense_hash);
+
+    return Container_InsDenseUIntHash(value, node, &probe, dense_hash);
+}
+
+inline enum container__error_code
+Container_InsDenseUIntHash (
+                            unsigned int                                     value,
+                            struct container__dense_uint_hash_node* restrict node,
+                            struct container__dense_hash_probe* restrict     probe,
+                            struct container__dense_uint_hash* restrict      dense_hash
+                           )
+{
+    unsigned int slot;
+
+    slot = probe->slot;
+    if(dense_hash->growth_left == 0)
+    {
+        enum container__error_code error;
+
+        error = Container_GrowDenseUIntHash(dense_hash);
+        if(error != container__error_none)
+            return error;
+
+        slot = Container_FindDenseUIntHashSlot(value, dense_hash);
+    }
+
+    node->value = value;
+
+    dense_hash->slots[slot].value = value;
+    dense_hash->slots[slot].node  = node;
+
+    dense_hash->node_count++;
+    dense_hash->growth_left--;
+
+    return container__error_none;
+}
+
+inline void
+Container_RemoveDenseUIntHash (
+                               struct container__dense_uint_hash_node* restrict node,
+                               struct container__dense_uint_hash* restrict      dense_hash
+                              )
+{
+    unsigned int hole;
+    unsigned int slot;
+
+    hole = Container_DenseUIntHashHome(node->value, dense_hash);
+    while(dense_hash->slots[hole].node != node)
+        hole = (hole+1)&dense_hash->slot_mask;
+
+    /*
+        Each later node of the run moves into the hole unless its home slot lies after the
+        hole, in which case moving it would place it before its home where no probe could
+        reach it
+     */
+    for(
+        slot = (hole+1)&dense_hash->slot_mask;
+        dense_hash->slots[slot].node != NULL;
+        slot = (slot+1)&dense_hash->slot_mask
+       )
+    {
+        unsigned int home;
+
+        home = Container_DenseUIntHashHome(dense_hash->slots[slot].value, dense_hash);
+        if(((slot-home)&dense_hash->slot_mask) >= ((slot-hole)&dense_hash->slot_mask))
+        {
+            dense_hash->slots[hole] = dense_hash->slots[slot];
+
+            hole = slot;
+        }
+    }
+
+    dense_hash->slots[hole].node = NULL;
+
+    dense_hash->node_count--;
+    dense_hash->growth_left++;
+}
+
+inline void
+Container_StartDenseUIntHashScan (
+                                  struct container__dense_uint_hash* restrict      dense_hash,
+                                  struct container__dense_uint_hash_scan* restrict scan
+                                 )
+{
+    scan->slot = 0;
+
+    Container_UpdateDenseUIntHashScan(dense_hash, scan);
+}
+
+inline void
+Container_ResumeDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict      dense_hash,
+                                   struct container__dense_uint_hash_scan* restrict scan
+                                  )
+{
+    scan->slot++;
+
+    Container_UpdateDenseUIntHashScan(dense_hash, scan);
+}
+
+inline enum container__dense_hash_scan_state
+Container_DenseUIntHashScanState (struct container__dense_uint_hash_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__dense_hash_scan_finished;
+
+    return container__dense_hash_scan_incomplete;
+}
+
+inline enum container__error_code
+Container_CreateDenseULongHash (
+                                unsigned int                                 count,
+                                struct container__dense_ulong_hash* restrict dense_hash
+                               )
+{
+    return Container_CreateDenseULongHashWithAllocator(count, NULL, dense_hash);
+}
+
+inline enum container__error_code
+Container_CreateDenseULongHashWithAllocator (
+                                             unsigned int                                 count,
+                                             const struct container__allocator*           allocator,
+                                             struct container__dense_ulong_hash* restrict dense_hash
+                                            )
+{
+    unsigned int shift;
+
+    dense_hash->allocator = allocator;
+
+    shift = CONTAINER__DENSE_HASH_MIN_SHIFT;
+    while(shift < CONTAINER__DENSE_HASH_MAX_SHIFT && (1u<<shift)/4*3 < count)
+        shift++;
+
+    return Container_AllocDenseULongHash(shift, dense_hash);
+}
+
+inline void
+Container_DestroyDenseULongHash (struct container__dense_ulong_hash* restrict dense_hash)
+{
+    size_t alloc_size;
+
+    alloc_size = sizeof(struct container__dense_ulong_hash_slot)*((size_t)dense_hash->slot_mask+1)+
+                 CONTAINER__HASH_CACHE_LINE_SIZE-1;
+
+    Container_FreeMemory(dense_hash->alloc_address, alloc_size, dense_hash->allocator);
+}
+
+inline void
+Container_ResetDenseULongHash (struct container__dense_ulong_hash* restrict dense_hash)
+{
+    for(unsigned int slot = 0; slot <= dense_hash->slot_mask; slot++)
+        dense_hash->slots[slot].node = NULL;
+
+    /*
+        Linear probing degrades quickly as the table fills, so the dense hash grows once three
+        quarters of its slots are in use
+     */
+    dense_hash->node_count  = 0;
+    dense_hash->growth_left = (dense_hash->slot_mask+1)/4*3;
+}
+
+inline struct container__dense_ulong_hash_node*
+Container_LookupDenseULongHash (
+                                unsigned long long                           value,
+                                struct container__dense_ulong_hash* restrict dense_hash,
+                                struct container__dense_hash_probe* restrict probe
+                               )
+{
+    unsigned int slot;
+
+    slot = Container_DenseULongHashHome(value, dense_hash);
+
+    for(;;)
+    {
+        struct container__dense_ulong_hash_slot* current;
+
+        current = &dense_hash->slots[slot];
+        if(current->node == NULL)
+            break;
+
+        if(current->value == value)
+            return current->node;
+
+        slot = (slot+1)&dense_hash->slot_mask;
+    }
+
+    probe->slot = slot;
+
+    return NULL;
+}
+
+inline enum container__error_code
+Container_AddDenseULongHash (
+                             unsigned long long                                value,
+                             struct container__dense_ulong_hash_node* restrict node,
+                             struct container__dense_ulong_hash* restrict      dense_hash
+                            )
+{
+    struct container__dense_hash_probe probe;
+
+    probe.slot = Container_FindDenseULongHashSlot(value, dense_hash);
+
+    return Container_InsDenseULongHash(value, node, &probe, dense_hash);
+}
+
+inline enum container__error_code
+Container_InsDenseULongHash (
+                             unsigned long long                                value,
+                             struct container__dense_ulong_hash_node* restrict node,
+                             struct container__dense_hash_probe* restrict      probe,
+                             struct container__dense_ulong_hash* restrict      dense_hash
+                            )
+{
+    unsigned int slot;
+
+    slot = probe->slot;
+    if(dense_hash->growth_left == 0)
+    {
+        enum container__error_code error;
+
+        error = Container_GrowDenseULongHash(dense_hash);
+        if(error != container__error_none)
+            return error;
+
+        slot = Container_FindDenseULongHashSlot(value, dense_hash);
+    }
+
+    node->value = value;
+
+    dense_hash->slots[slot].value = value;
+    dense_hash->slots[slot].node  = node;
+
+    dense_hash->node_count++;
+    dense_hash->growth_left--;
+
+    return container__error_none;
+}
+
+inline void
+Container_RemoveDenseULongHash (
+                                struct container__dense_ulong_hash_node* restrict node,
+                                struct container__dense_ulong_hash* restrict      dense_hash
+                               )
+{
+    unsigned int hole;
+    unsigned int slot;
+
+    hole = Container_DenseULongHashHome(node->value, dense_hash);
+    while(dense_hash->slots[hole].node != node)
+        hole = (hole+1)&dense_hash->slot_mask;
+
+    /*
+        Each later node of the run moves into the hole unless its home slot lies after the
+        hole, in which case moving it would place it before its home where no probe could
+        reach it
+     */
+    for(
+        slot = (hole+1)&dense_hash->slot_mask;
+        dense_hash->slots[slot].node != NULL;
+        slot = (slot+1)&dense_hash->slot_mask
+       )
+    {
+        unsigned int home;
+
+        home = Container_DenseULongHashHome(dense_hash->slots[slot].value, dense_hash);
+        if(((slot-home)&dense_hash->slot_mask) >= ((slot-hole)&dense_hash->slot_mask))
+        {
+            dense_hash->slots[hole] = dense_hash->slots[slot];
+
+            hole = slot;
+        }
+    }
+
+    dense_hash->slots[hole].node = NULL;
+
+    dense_hash->node_count--;
+    dense_hash->growth_left++;
+}
+
+inline void
+Container_StartDenseULongHashScan (
+                                   struct container__dense_ulong_hash* restrict      dense_hash,
+                                   struct container__dense_ulong_hash_scan* restrict scan
+                                  )
+{
+    scan->slot = 0;
+
+    Container_UpdateDenseULongHashScan(dense_hash, scan);
+}
+
+inline void
+Container_ResumeDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict      dense_hash,
+                                    struct container__dense_ulong_hash_scan* restrict scan
+                                   )
+{
+    scan->slot++;
+
+    Container_UpdateDenseULongHashScan(dense_hash, scan);
+}
+
+inline enum container__dense_hash_scan_state
+Container_DenseULongHashScanState (struct container__dense_ulong_hash_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__dense_hash_scan_finished;
+
+    return container__dense_hash_scan_incomplete;
+}
+
+
+#endif
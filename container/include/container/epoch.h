@@ -0,0 +1,391 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The epoch container defers the reclamation of nodes which lock-free readers may still be
+    visiting.  Each reader owns a reader slot and marks the epoch it entered in that slot for
+    the duration of each read-side critical section.  The writer retires nodes once they are
+    unreachable, and a retired node is only handed to the reclaim function once every reader
+    which could have observed it has left its critical section.  Readers never write to shared
+    memory other than their own slot, and the retire and reclaim functions must only be called
+    by one thread at a time
+ */
+
+
+#ifndef _CONTAINER__EPOCH_H_
+#define _CONTAINER__EPOCH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/queue.h>
+
+
+/*
+    The size of each reader slot, chosen so that readers on different cores don't write to
+    the same cache line
+ */
+#define CONTAINER__EPOCH_READER_SIZE 64
+
+
+/*
+    A reader slot.  The active epoch is zero while the reader is outside of a critical section
+ */
+struct container__epoch_reader
+{
+    unsigned long active_epoch;
+    char          padding[CONTAINER__EPOCH_READER_SIZE-sizeof(unsigned long)];
+};
+
+/*
+    The node data to be placed in each element which may be retired
+
+    Accessible members:
+        retire_epoch -- the epoch in which the node was retired
+ */
+struct container__epoch_node
+{
+    unsigned long                retire_epoch;
+    struct container__queue_node node;
+};
+
+
+/*
+    The required type for a user-defined reclaim function, invoked once a retired node may no
+    longer be visited by any reader
+
+    For example:
+        void
+        MyReclaim (struct container__epoch_node* restrict node, void* user_data)
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(node, struct my_element, epoch_node);
+
+            free(element);
+        }
+ */
+typedef void
+(*container__epoch_reclaim_type) (struct container__epoch_node* restrict, void*);
+
+
+/*
+    The epoch container itself
+
+    Accessible members:
+        allocator -- the allocator used for the reader slots
+ */
+struct container__epoch
+{
+    unsigned long                      global_epoch;
+    unsigned int                       reader_count;
+    struct container__epoch_reader*    readers;
+    struct container__queue            retired;
+    container__epoch_reclaim_type      reclaim;
+    void*                              user_data;
+    const struct container__allocator* allocator;
+};
+
+
+/*
+    Initialize an epoch container with an array of reader slots
+
+    Syntax:
+        Container_InitEpoch(reader_count, my_readers_array, &MyReclaim, my_user_data, &my_epoch);
+ */
+inline void
+Container_InitEpoch (
+                     unsigned int,
+                     struct container__epoch_reader* restrict,
+                     container__epoch_reclaim_type,
+                     void*,
+                     struct container__epoch* restrict
+                    );
+
+/*
+    Allocate reader slots and initialize an epoch container
+
+    Syntax:
+        error = Container_CreateEpoch(reader_count, &MyReclaim, my_user_data, &my_epoch);
+ */
+inline enum container__error_code
+Container_CreateEpoch (
+                       unsigned int,
+                       container__epoch_reclaim_type,
+                       void*,
+                       struct container__epoch* restrict
+                      );
+
+/*
+    Allocate reader slots using an allocator and initialize an epoch container.  The
+    allocator's alignment should be a multiple of CONTAINER__EPOCH_READER_SIZE for each slot to
+    sit on its own cache line
+
+    Syntax:
+        error = Container_CreateEpochWithAllocator(
+                                                   reader_count,
+                                                   &MyReclaim,
+                                                   my_user_data,
+                                                   &my_allocator,
+                                                   &my_epoch
+                                                  );
+ */
+inline enum container__error_code
+Container_CreateEpochWithAllocator (
+                                    unsigned int,
+                                    container__epoch_reclaim_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__epoch* restrict
+                                   );
+
+/*
+    Cleanup a previously created epoch container.  Every node still retired is reclaimed, so no
+    reader may be within a critical section
+
+    Syntax:
+        Container_DestroyEpoch(&my_epoch);
+ */
+inline void
+Container_DestroyEpoch (struct container__epoch* restrict);
+
+
+/*
+    Enter a read-side critical section using the specified reader slot.  Nodes reached within
+    the critical section remain valid until the reader exits it
+
+    Syntax:
+        Container_EnterEpoch(my_reader_index, &my_epoch);
+ */
+inline void
+Container_EnterEpoch (unsigned int, struct container__epoch* restrict);
+
+/*
+    Exit a read-side critical section using the specified reader slot
+
+    Syntax:
+        Container_ExitEpoch(my_reader_index, &my_epoch);
+ */
+inline void
+Container_ExitEpoch (unsigned int, struct container__epoch* restrict);
+
+
+/*
+    Retire a node which has been made unreachable by new readers.  The node will be passed to
+    the reclaim function by a later call to Container_ReclaimEpoch
+
+    Syntax:
+        Container_RetireEpochNode(&my_element.epoch_node, &my_epoch);
+ */
+inline void
+Container_RetireEpochNode (
+                           struct container__epoch_node* restrict,
+                           struct container__epoch* restrict
+                          );
+
+/*
+    Advance the epoch and reclaim every retired node which no reader may still be visiting.
+    Nodes retired while a reader remains within a critical section are kept until a later call
+
+    Syntax:
+        Container_ReclaimEpoch(&my_epoch);
+ */
+inline void
+Container_ReclaimEpoch (struct container__epoch* restrict);
+
+
+#include <container/utils.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+inline unsigned long
+Container_MinActiveEpoch (struct container__epoch* restrict);
+
+inline void
+Container_ReclaimEpochBefore (unsigned long, struct container__epoch* restrict);
+
+
+inline unsigned long
+Container_MinActiveEpoch (struct container__epoch* restrict epoch)
+{
+    unsigned long min_epoch;
+    unsigned int  index;
+
+    min_epoch = __atomic_load_n(&epoch->global_epoch, __ATOMIC_RELAXED);
+
+    for(index = 0; index < epoch->reader_count; index++)
+    {
+        unsigned long active_epoch;
+
+        active_epoch = __atomic_load_n(&epoch->readers[index].active_epoch, __ATOMIC_ACQUIRE);
+        if(active_epoch != 0 && active_epoch < min_epoch)
+            min_epoch = active_epoch;
+    }
+
+    return min_epoch;
+}
+
+inline void
+Container_ReclaimEpochBefore (unsigned long min_epoch, struct container__epoch* restrict epoch)
+{
+    while(Container_QueueState(&epoch->retired) != container__queue_empty)
+    {
+        struct container__epoch_node* epoch_node;
+
+        epoch_node = CONTAINER__CONTAINER_OF(
+                                             epoch->retired.head,
+                                             struct container__epoch_node,
+                                             node
+                                            );
+        if(epoch_node->retire_epoch >= min_epoch)
+            break;
+
+        Container_RemoveQueueHead(&epoch->retired);
+
+        (*epoch->reclaim)(epoch_node, epoch->user_data);
+    }
+}
+
+
+inline void
+Container_InitEpoch (
+                     unsigned int                             count,
+                     struct container__epoch_reader* restrict readers,
+                     container__epoch_reclaim_type            reclaim,
+                     void*                                    user_data,
+                     struct container__epoch* restrict        epoch
+                    )
+{
+    unsigned int index;
+
+    epoch->global_epoch = 1;
+    epoch->reader_count = count;
+    epoch->readers      = readers;
+    epoch->reclaim      = reclaim;
+    epoch->user_data    = user_data;
+    epoch->allocator    = NULL;
+
+    for(index = 0; index < count; index++)
+        readers[index].active_epoch = 0;
+
+    Container_InitQueue(&epoch->retired);
+}
+
+inline enum container__error_code
+Container_CreateEpoch (
+                       unsigned int                      count,
+                       container__epoch_reclaim_type     reclaim,
+                       void*                             user_data,
+                       struct container__epoch* restrict epoch
+                      )
+{
+    return Container_CreateEpochWithAllocator(count, reclaim, user_data, NULL, epoch);
+}
+
+inline enum container__error_code
+Container_CreateEpochWithAllocator (
+                                    unsigned int                       count,
+                                    container__epoch_reclaim_type      reclaim,
+                                    void*                              user_data,
+                                    const struct container__allocator* allocator,
+                                    struct container__epoch* restrict  epoch
+                                   )
+{
+    struct container__epoch_reader* readers;
+
+    readers = Container_AllocMemory(sizeof(struct container__epoch_reader)*count, allocator);
+    if(readers == NULL)
+        return container__error_memory_alloc;
+
+    Container_InitEpoch(count, readers, reclaim, user_data, epoch);
+
+    epoch->allocator = allocator;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyEpoch (struct container__epoch* restrict epoch)
+{
+    Container_ReclaimEpochBefore((unsigned long)-1, epoch);
+
+    Container_FreeMemory(
+                         epoch->readers,
+                         sizeof(struct container__epoch_reader)*epoch->reader_count,
+                         epoch->allocator
+                        );
+}
+
+inline void
+Container_EnterEpoch (unsigned int reader_index, struct container__epoch* restrict epoch)
+{
+    unsigned long global_epoch;
+
+    global_epoch = __atomic_load_n(&epoch->global_epoch, __ATOMIC_ACQUIRE);
+
+    __atomic_store_n(&epoch->readers[reader_index].active_epoch, global_epoch, __ATOMIC_RELAXED);
+
+    /*
+        The slot must be visible to the writer before any node is loaded, otherwise the writer
+        could miss this reader and reclaim a node it is about to visit
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+inline void
+Container_ExitEpoch (unsigned int reader_index, struct container__epoch* restrict epoch)
+{
+    __atomic_store_n(&epoch->readers[reader_index].active_epoch, 0, __ATOMIC_RELEASE);
+}
+
+inline void
+Container_RetireEpochNode (
+                           struct container__epoch_node* restrict node,
+                           struct container__epoch* restrict      epoch
+                          )
+{
+    node->retire_epoch = __atomic_load_n(&epoch->global_epoch, __ATOMIC_RELAXED);
+
+    Container_AddQueueTail(&node->node, &epoch->retired);
+}
+
+inline void
+Container_ReclaimEpoch (struct container__epoch* restrict epoch)
+{
+    unsigned long min_epoch;
+
+    __atomic_fetch_add(&epoch->global_epoch, 1, __ATOMIC_SEQ_CST);
+
+    /*
+        Pairs with the fence in Container_EnterEpoch.  Either the reader's slot is seen here, or
+        the reader sees every node unlinked before this point as unreachable
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    min_epoch = Container_MinActiveEpoch(epoch);
+
+    Container_ReclaimEpochBefore(min_epoch, epoch);
+}
+
+
+#endif
@@ -0,0 +1,818 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The flathash container manages a hash of elements using open addressing.  Slots are
+    arranged in groups of 16, each slot having a control byte holding 7 bits of the hash value
+    of the node in the slot.  A lookup compares all 16 control bytes of a group at once using
+    SSE2 or NEON where available, so a lookup usually touches one group of control bytes and
+    one node.
+
+    The flathash stores pointers to nodes placed in each element, rather than the elements
+    themselves, so elements never move as the flathash grows
+ */
+
+
+#ifndef _CONTAINER__FLATHASH_H_
+#define _CONTAINER__FLATHASH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hash.h>
+
+
+/*
+    The number of slots in each group of control bytes
+ */
+#define CONTAINER__FLATHASH_GROUP_SIZE 16
+
+
+/*
+    Valid states for a scan of a flathash
+ */
+enum container__flathash_scan_state
+{
+    container__flathash_scan_incomplete,
+    container__flathash_scan_finished
+};
+
+
+/*
+    The node data to be placed in each flathash element
+ */
+struct container__flathash_node
+{
+    unsigned int value_hash;
+    unsigned int slot;
+};
+
+/*
+    The flathash container itself
+
+    Accessible members:
+        node_count -- the number of nodes currently in the flathash
+        allocator  -- the allocator used for the slots
+ */
+struct container__flathash
+{
+    unsigned int node_count;
+    unsigned int growth_left;
+
+    unsigned int group_mask;
+    unsigned int index_shift;
+
+    unsigned char*                     control;
+    struct container__flathash_node**  slots;
+    const struct container__allocator* allocator;
+};
+
+/*
+    The result of probing a flathash for a node, used to insert a node following a
+    failed lookup without probing again
+ */
+struct container__flathash_probe
+{
+    unsigned int value_hash;
+    unsigned int slot;
+};
+
+/*
+    The scan structure used to scan every node in a flathash
+
+    Accessible members:
+        current_node -- the current element node being visited
+ */
+struct container__flathash_scan
+{
+    struct container__flathash_node* current_node;
+
+    unsigned int slot;
+};
+
+
+/*
+    The required type for a user-defined flathash lookup function.  The lookup function is
+    only invoked for nodes whose hash value matches the hash value being looked up
+
+    For example:
+        enum container__hash_cmp_result
+        MyLookup (
+                  void*                                     id_to_lookup,
+                  struct container__flathash_node* restrict cmp_node,
+                  void*                                     user_data
+                 )
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(cmp_node, struct my_element, node);
+
+            if(element->my_id == *(my_id_type*)id_to_lookup)
+                return container__hash_node_equal;
+
+            return container__hash_node_not_equal;
+        }
+ */
+typedef enum container__hash_cmp_result
+(*container__flathash_lookup_type) (
+                                    void*,
+                                    struct container__flathash_node* restrict,
+                                    void*
+                                   );
+
+
+/*
+    Allocate the slots for and initialize a flathash able to hold the specified number of
+    nodes before growing.  The container will be empty upon initialization
+
+    Syntax:
+        error = Container_CreateFlatHash(expected_node_count, &my_flathash);
+ */
+inline enum container__error_code
+Container_CreateFlatHash (unsigned int, struct container__flathash* restrict);
+
+/*
+    Allocate the slots for and initialize a flathash as with Container_CreateFlatHash, using
+    an allocator.  The allocator is also used as the flathash grows
+
+    Syntax:
+        error = Container_CreateFlatHashWithAllocator(
+                                                      expected_node_count,
+                                                      &my_allocator,
+                                                      &my_flathash
+                                                     );
+ */
+inline enum container__error_code
+Container_CreateFlatHashWithAllocator (
+                                       unsigned int,
+                                       const struct container__allocator*,
+                                       struct container__flathash* restrict
+                                      );
+
+/*
+    Cleanup a previously created flathash
+
+    Syntax:
+        Container_DestroyFlatHash(&my_flathash);
+ */
+inline void
+Container_DestroyFlatHash (struct container__flathash* restrict);
+
+
+/*
+    Reset a flathash container to the initialized state
+
+    Syntax:
+        Container_ResetFlatHash(&my_flathash);
+ */
+inline void
+Container_ResetFlatHash (struct container__flathash* restrict);
+
+
+/*
+    Lookup a node in the flathash.  Upon completion, the probe will be set for use with
+    Container_InsFlatHashNode and the found node returned.  If no node was found, NULL is
+    returned
+
+    Syntax:
+        found_node = Container_LookupFlatHashNode(
+                                                  MyHashValue(lookup_id),
+                                                  &lookup_id,
+                                                  &my_flathash,
+                                                  &MyLookup,
+                                                  my_user_data,
+                                                  &probe
+                                                 );
+ */
+inline struct container__flathash_node*
+Container_LookupFlatHashNode (
+                              unsigned int,
+                              void*,
+                              struct container__flathash* restrict,
+                              container__flathash_lookup_type,
+                              void*,
+                              struct container__flathash_probe* restrict
+                             );
+
+
+/*
+    Add a node to the flathash, specifying the hash value for the node.  An error is returned
+    should the flathash need to grow and allocating more slots fail
+
+    Syntax:
+        error = Container_AddFlatHashNode(
+                                          MyHashValue(my_element.my_id),
+                                          &my_element.node,
+                                          &my_flathash
+                                         );
+ */
+inline enum container__error_code
+Container_AddFlatHashNode (
+                           unsigned int,
+                           struct container__flathash_node* restrict,
+                           struct container__flathash* restrict
+                          );
+
+/*
+    Insert a node using the probe from a failed lookup.  The flathash must not have been
+    modified since the lookup.  An error is returned should the flathash need to grow and
+    allocating more slots fail
+
+    Syntax:
+        error = Container_InsFlatHashNode(&my_element.node, &probe, &my_flathash);
+ */
+inline enum container__error_code
+Container_InsFlatHashNode (
+                           struct container__flathash_node* restrict,
+                           struct container__flathash_probe* restrict,
+                           struct container__flathash* restrict
+                          );
+
+/*
+    Remove a node from the flathash
+
+    Syntax:
+        Container_RemoveFlatHashNode(&my_element.node, &my_flathash);
+ */
+inline void
+Container_RemoveFlatHashNode (
+                              struct container__flathash_node* restrict,
+                              struct container__flathash* restrict
+                             );
+
+
+/*
+    Start a scan of every node in the flathash.  Nodes may be removed during a scan, but adding
+    nodes may cause nodes to be skipped or visited twice
+
+    Syntax:
+        Container_StartFlatHashScan(&my_flathash, &scan);
+ */
+inline void
+Container_StartFlatHashScan (
+                             struct container__flathash* restrict,
+                             struct container__flathash_scan* restrict
+                            );
+
+/*
+    Resume a scan of a flathash
+
+    Syntax:
+        Container_ResumeFlatHashScan(&my_flathash, &scan);
+ */
+inline void
+Container_ResumeFlatHashScan (
+                              struct container__flathash* restrict,
+                              struct container__flathash_scan* restrict
+                             );
+
+/*
+    Return the state of a flathash scan
+
+    Syntax:
+        scan_state = Container_FlatHashScanState(&scan);
+ */
+inline enum container__flathash_scan_state
+Container_FlatHashScanState (struct container__flathash_scan* restrict);
+
+
+#include <container/utils.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+
+/*
+    Control byte values.  Slots holding a node have the high bit clear
+ */
+#define CONTAINER__FLATHASH_EMPTY   0x80
+#define CONTAINER__FLATHASH_DELETED 0xFE
+
+#define CONTAINER__FLATHASH_NO_SLOT   0xFFFFFFFFu
+#define CONTAINER__FLATHASH_MAX_SHIFT 27
+
+
+inline unsigned int
+Container_FlatHashFirstMatch (unsigned int);
+
+inline unsigned int
+Container_MatchFlatHashGroup (const unsigned char* restrict, unsigned char);
+
+inline unsigned int
+Container_MatchFlatHashGroupFree (const unsigned char* restrict);
+
+inline unsigned int
+Container_MatchFlatHashGroupEmpty (const unsigned char* restrict);
+
+inline unsigned char
+Container_FlatHashTag (unsigned int);
+
+inline unsigned int
+Container_FlatHashGroupIndex (unsigned int, struct container__flathash* restrict);
+
+inline unsigned int
+Container_FlatHashCapacity (struct container__flathash* restrict);
+
+inline unsigned int
+Container_FindFlatHashSlot (unsigned int, struct container__flathash* restrict);
+
+inline void
+Container_PlaceFlatHashNode (
+                             unsigned int,
+                             unsigned int,
+                             struct container__flathash_node* restrict,
+                             struct container__flathash* restrict
+                            );
+
+inline enum container__error_code
+Container_AllocFlatHash (unsigned int, struct container__flathash* restrict);
+
+inline enum container__error_code
+Container_RehashFlatHash (struct container__flathash* restrict);
+
+inline void
+Container_UpdateFlatHashScan (
+                              struct container__flathash* restrict,
+                              struct container__flathash_scan* restrict
+                             );
+
+
+inline unsigned int
+Container_FlatHashFirstMatch (unsigned int mask)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(mask);
+#else
+    unsigned int index;
+
+    for(index = 0; (mask&1) == 0; index++)
+        mask >>= 1;
+
+    return index;
+#endif
+}
+
+inline unsigned int
+Container_MatchFlatHashGroup (const unsigned char* restrict group, unsigned char tag)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i control;
+
+    control = _mm_loadu_si128((const __m128i*)group);
+
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)tag)));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    static const uint8_t bits[CONTAINER__FLATHASH_GROUP_SIZE] = {
+                                                                  1, 2, 4, 8, 16, 32, 64, 128,
+                                                                  1, 2, 4, 8, 16, 32, 64, 128
+                                                                 };
+    uint8x16_t           matches;
+
+    matches = vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag));
+    matches = vandq_u8(matches, vld1q_u8(bits));
+
+    return vaddv_u8(vget_low_u8(matches))|((unsigned int)vaddv_u8(vget_high_u8(matches))<<8);
+#else
+    unsigned int mask;
+
+    mask = 0;
+    for(unsigned int index = 0; index < CONTAINER__FLATHASH_GROUP_SIZE; index++)
+        mask |= (unsigned int)(group[index] == tag)<<index;
+
+    return mask;
+#endif
+}
+
+inline unsigned int
+Container_MatchFlatHashGroupFree (const unsigned char* restrict group)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    unsigned int mask;
+
+    mask = 0;
+    for(unsigned int index = 0; index < CONTAINER__FLATHASH_GROUP_SIZE; index++)
+        mask |= (unsigned int)(group[index]>>7)<<index;
+
+    return mask;
+#endif
+}
+
+inline unsigned int
+Container_MatchFlatHashGroupEmpty (const unsigned char* restrict group)
+{
+    return Container_MatchFlatHashGroup(group, CONTAINER__FLATHASH_EMPTY);
+}
+
+inline unsigned char
+Container_FlatHashTag (unsigned int value_hash)
+{
+    return (unsigned char)((value_hash^(value_hash>>16))&0x7F);
+}
+
+inline unsigned int
+Container_FlatHashGroupIndex (unsigned int value_hash, struct container__flathash* restrict flathash)
+{
+    uint32_t mixed_hash;
+
+    if(flathash->group_mask == 0)
+        return 0;
+
+    mixed_hash = (uint32_t)value_hash*CONTAINER__HASH_MULTIPLIER;
+
+    return mixed_hash>>flathash->index_shift;
+}
+
+inline unsigned int
+Container_FlatHashCapacity (struct container__flathash* restrict flathash)
+{
+    return (flathash->group_mask+1)*CONTAINER__FLATHASH_GROUP_SIZE;
+}
+
+inline unsigned int
+Container_FindFlatHashSlot (unsigned int value_hash, struct container__flathash* restrict flathash)
+{
+    unsigned int group;
+
+    group = Container_FlatHashGroupIndex(value_hash, flathash);
+
+    for(unsigned int probe_index = 1; ; probe_index++)
+    {
+        unsigned char* control;
+        unsigned int   free_mask;
+
+        control   = &flathash->control[group*CONTAINER__FLATHASH_GROUP_SIZE];
+        free_mask = Container_MatchFlatHashGroupFree(control);
+        if(free_mask != 0)
+            return group*CONTAINER__FLATHASH_GROUP_SIZE+Container_FlatHashFirstMatch(free_mask);
+
+        group = (group+probe_index)&flathash->group_mask;
+    }
+}
+
+inline void
+Container_PlaceFlatHashNode (
+                             unsigned int                              value_hash,
+                             unsigned int                              slot,
+                             struct container__flathash_node* restrict node,
+                             struct container__flathash* restrict      flathash
+                            )
+{
+    if(flathash->control[slot] == CONTAINER__FLATHASH_EMPTY)
+        flathash->growth_left--;
+
+    flathash->control[slot] = Container_FlatHashTag(value_hash);
+    flathash->slots[slot]   = node;
+
+    node->value_hash = value_hash;
+    node->slot       = slot;
+
+    flathash->node_count++;
+}
+
+inline enum container__error_code
+Container_AllocFlatHash (unsigned int shift, struct container__flathash* restrict flathash)
+{
+    unsigned char* memory;
+    unsigned int   capacity;
+
+    if(shift > CONTAINER__FLATHASH_MAX_SHIFT)
+        return container__error_resource_unavailable;
+
+    capacity = (unsigned int)CONTAINER__FLATHASH_GROUP_SIZE<<shift;
+    memory   = Container_AllocMemory(
+                                     (sizeof(struct container__flathash_node*)+1)*(size_t)capacity,
+                                     flathash->allocator
+                                    );
+    if(memory == NULL)
+        return container__error_memory_alloc;
+
+    flathash->slots       = (struct container__flathash_node**)memory;
+    flathash->control     = memory+sizeof(struct container__flathash_node*)*(size_t)capacity;
+    flathash->group_mask  = (1u<<shift)-1;
+    flathash->index_shift = shift > 0 ? 32-shift : 0;
+
+    Container_ResetFlatHash(flathash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_RehashFlatHash (struct container__flathash* restrict flathash)
+{
+    struct container__flathash  old_flathash;
+    enum container__error_code  error;
+    unsigned int                old_capacity;
+    unsigned int                shift;
+
+    old_flathash = *flathash;
+    old_capacity = Container_FlatHashCapacity(&old_flathash);
+
+    shift = 0;
+    while((1u<<shift) <= old_flathash.group_mask)
+        shift++;
+
+    /* Grow unless removed slots make up most of the load, in which case rehash in place */
+    if(old_flathash.node_count >= old_capacity/2)
+        shift++;
+
+    error = Container_AllocFlatHash(shift, flathash);
+    if(error != container__error_none)
+    {
+        *flathash = old_flathash;
+
+        return error;
+    }
+
+    for(unsigned int slot = 0; slot < old_capacity; slot++)
+    {
+        struct container__flathash_node* node;
+
+        if((old_flathash.control[slot]&0x80) != 0)
+            continue;
+
+        node = old_flathash.slots[slot];
+
+        Container_PlaceFlatHashNode(
+                                    node->value_hash,
+                                    Container_FindFlatHashSlot(node->value_hash, flathash),
+                                    node,
+                                    flathash
+                                   );
+    }
+
+    Container_DestroyFlatHash(&old_flathash);
+
+    return container__error_none;
+}
+
+inline void
+Container_UpdateFlatHashScan (
+                              struct container__flathash* restrict      flathash,
+                              struct container__flathash_scan* restrict scan
+                             )
+{
+    unsigned int capacity;
+    unsigned int slot;
+
+    capacity = Container_FlatHashCapacity(flathash);
+
+    for(slot = scan->slot; slot < capacity; slot++)
+    {
+        if((flathash->control[slot]&0x80) == 0)
+        {
+            scan->slot         = slot;
+            scan->current_node = flathash->slots[slot];
+
+            return;
+        }
+    }
+
+    scan->slot         = capacity;
+    scan->current_node = NULL;
+}
+
+
+inline enum container__error_code
+Container_CreateFlatHash (unsigned int count, struct container__flathash* restrict flathash)
+{
+    return Container_CreateFlatHashWithAllocator(count, NULL, flathash);
+}
+
+inline enum container__error_code
+Container_CreateFlatHashWithAllocator (
+                                       unsigned int                         count,
+                                       const struct container__allocator*   allocator,
+                                       struct container__flathash* restrict flathash
+                                      )
+{
+    unsigned int shift;
+
+    flathash->allocator = allocator;
+
+    shift = 0;
+    while(shift < CONTAINER__FLATHASH_MAX_SHIFT &&
+          ((unsigned int)CONTAINER__FLATHASH_GROUP_SIZE<<shift)/8*7 < count)
+        shift++;
+
+    return Container_AllocFlatHash(shift, flathash);
+}
+
+inline void
+Container_DestroyFlatHash (struct container__flathash* restrict flathash)
+{
+    Container_FreeMemory(
+                         flathash->slots,
+                         (sizeof(struct container__flathash_node*)+1)*
+                         (size_t)Container_FlatHashCapacity(flathash),
+                         flathash->allocator
+                        );
+}
+
+inline void
+Container_ResetFlatHash (struct container__flathash* restrict flathash)
+{
+    unsigned int capacity;
+
+    capacity = Container_FlatHashCapacity(flathash);
+
+    memset(flathash->control, CONTAINER__FLATHASH_EMPTY, capacity);
+
+    flathash->node_count  = 0;
+    flathash->growth_left = capacity-capacity/8;
+}
+
+inline struct container__flathash_node*
+Container_LookupFlatHashNode (
+                              unsigned int                               value_hash,
+                              void*                                      value,
+                              struct container__flathash* restrict       flathash,
+                              container__flathash_lookup_type            lookup,
+                              void*                                      user_data,
+                              struct container__flathash_probe* restrict probe
+                             )
+{
+    unsigned char tag;
+    unsigned int  group;
+
+    tag   = Container_FlatHashTag(value_hash);
+    group = Container_FlatHashGroupIndex(value_hash, flathash);
+
+    probe->value_hash = value_hash;
+    probe->slot       = CONTAINER__FLATHASH_NO_SLOT;
+
+    for(unsigned int probe_index = 1; probe_index <= flathash->group_mask+1; probe_index++)
+    {
+        unsigned char* control;
+        unsigned int   match_mask;
+
+        control    = &flathash->control[group*CONTAINER__FLATHASH_GROUP_SIZE];
+        match_mask = Container_MatchFlatHashGroup(control, tag);
+
+        while(match_mask != 0)
+        {
+            struct container__flathash_node* node;
+            unsigned int                     slot;
+
+            slot = group*CONTAINER__FLATHASH_GROUP_SIZE+Container_FlatHashFirstMatch(match_mask);
+            node = flathash->slots[slot];
+
+            if(node->value_hash == value_hash)
+            {
+                enum container__hash_cmp_result result;
+
+                result = (*lookup)(value, node, user_data);
+                if(result == container__hash_node_equal)
+                    return node;
+            }
+
+            match_mask &= match_mask-1;
+        }
+
+        if(probe->slot == CONTAINER__FLATHASH_NO_SLOT)
+        {
+            unsigned int free_mask;
+
+            free_mask = Container_MatchFlatHashGroupFree(control);
+            if(free_mask != 0)
+                probe->slot = group*CONTAINER__FLATHASH_GROUP_SIZE+Container_FlatHashFirstMatch(free_mask);
+        }
+
+        if(Container_MatchFlatHashGroupEmpty(control) != 0)
+            break;
+
+        group = (group+probe_index)&flathash->group_mask;
+    }
+
+    return NULL;
+}
+
+inline enum container__error_code
+Container_AddFlatHashNode (
+                           unsigned int                              value_hash,
+                           struct container__flathash_node* restrict node,
+                           struct container__flathash* restrict      flathash
+                          )
+{
+    struct container__flathash_probe probe;
+
+    probe.value_hash = value_hash;
+    probe.slot       = Container_FindFlatHashSlot(value_hash, flathash);
+
+    return Container_InsFlatHashNode(node, &probe, flathash);
+}
+
+inline enum container__error_code
+Container_InsFlatHashNode (
+                           struct container__flathash_node* restrict  node,
+                           struct container__flathash_probe* restrict probe,
+                           struct container__flathash* restrict       flathash
+                          )
+{
+    unsigned int slot;
+
+    slot = probe->slot;
+    if(slot == CONTAINER__FLATHASH_NO_SLOT ||
+       (flathash->growth_left == 0 && flathash->control[slot] == CONTAINER__FLATHASH_EMPTY))
+    {
+        enum container__error_code error;
+
+        error = Container_RehashFlatHash(flathash);
+        if(error != container__error_none)
+            return error;
+
+        slot = Container_FindFlatHashSlot(probe->value_hash, flathash);
+    }
+
+    Container_PlaceFlatHashNode(probe->value_hash, slot, node, flathash);
+
+    return container__error_none;
+}
+
+inline void
+Container_RemoveFlatHashNode (
+                              struct container__flathash_node* restrict node,
+                              struct container__flathash* restrict      flathash
+                             )
+{
+    unsigned char* control;
+    unsigned int   slot;
+
+    slot    = node->slot;
+    control = &flathash->control[slot&~(CONTAINER__FLATHASH_GROUP_SIZE-1)];
+
+    /*
+        A group which still has an empty slot has never been full, so no probe has passed
+        through it and the slot may be marked empty rather than deleted
+     */
+    if(Container_MatchFlatHashGroupEmpty(control) != 0)
+    {
+        flathash->control[slot] = CONTAINER__FLATHASH_EMPTY;
+        flathash->growth_left++;
+    }
+    else
+        flathash->control[slot] = CONTAINER__FLATHASH_DELETED;
+
+    flathash->node_count--;
+}
+
+inline void
+Container_StartFlatHashScan (
+                             struct container__flathash* restrict      flathash,
+                             struct container__flathash_scan* restrict scan
+                            )
+{
+    scan->slot = 0;
+
+    Container_UpdateFlatHashScan(flathash, scan);
+}
+
+inline void
+Container_ResumeFlatHashScan (
+                              struct container__flathash* restrict      flathash,
+                              struct container__flathash_scan* restrict scan
+                             )
+{
+    scan->slot++;
+
+    Container_UpdateFlatHashScan(flathash, scan);
+}
+
+inline enum container__flathash_scan_state
+Container_FlatHashScanState (struct container__flathash_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__flathash_scan_finished;
+
+    return container__flathash_scan_incomplete;
+}
+
+
+#endif
@@ -28,10 +28,35 @@
 #define _CONTAINER__HASH_H_
 
 
+#include <stddef.h>
+
 #include <container/error.h>
+#include <container/alloc.h>
 #include <container/clist.h>
 
 
+/*
+    The largest base 2 logarithm of a bucket count which may be used with the shift functions
+ */
+#define CONTAINER__HASH_MAX_SHIFT 31
+
+/*
+    The number of entries in the chain length histogram of the hash stats.  Chains at least as
+    long as the last entry are counted in the last entry
+ */
+#define CONTAINER__HASH_HISTOGRAM_SIZE 16
+
+/*
+    The alignment of buckets allocated with container__hash_alloc_aligned
+ */
+#define CONTAINER__HASH_CACHE_LINE_SIZE 64
+
+/*
+    The page size buckets allocated with container__hash_alloc_huge_pages are rounded up to
+ */
+#define CONTAINER__HASH_HUGE_PAGE_SIZE ((size_t)2*1024*1024)
+
+
 /*
     Valid values a hash lookup function may return
  */
@@ -41,6 +66,19 @@ enum container__hash_cmp_result
     container__hash_node_equal
 };
 
+/*
+    The ways hash buckets may be allocated.  Huge page allocation maps the buckets with
+    MAP_HUGETLB where huge pages have been reserved, and otherwise maps huge page aligned
+    memory and advises the kernel to back it with transparent huge pages.  Where neither is
+    available, buckets are allocated as with container__hash_alloc_aligned
+ */
+enum container__hash_alloc_type
+{
+    container__hash_alloc_default,
+    container__hash_alloc_aligned,
+    container__hash_alloc_huge_pages
+};
+
 /*
     Valid states for a hash bucket
  */
@@ -59,6 +97,24 @@ enum container__hash_bucket_scan_state
     container__hash_bucket_scan_finished
 };
 
+/*
+    Valid states for a scan of the nodes equal to a value
+ */
+enum container__hash_equal_scan_state
+{
+    container__hash_equal_scan_incomplete,
+    container__hash_equal_scan_finished
+};
+
+/*
+    Valid states for a scan of an entire hash
+ */
+enum container__hash_scan_state
+{
+    container__hash_scan_incomplete,
+    container__hash_scan_finished
+};
+
 
 /*
     The node data to be placed in each hash element
@@ -68,6 +124,21 @@ struct container__hash_node
     struct container__clist_node node;
 };
 
+/*
+    The node data to be placed in each hash element when the hash value of each node is to be
+    cached.  Lookups using Container_LookupCachedHashNode only invoke the lookup function for
+    nodes whose cached hash value matches, and Container_CachedHashValue returns the cached
+    hash value so nodes may be rehashed without recomputing their hash values
+
+    Accessible members:
+        value_hash -- the hash value the node was added with
+ */
+struct container__cached_hash_node
+{
+    unsigned int                value_hash;
+    struct container__hash_node node;
+};
+
 /*
     The buckets which make up the hash container
  */
@@ -77,12 +148,82 @@ struct container__hash_bucket
 };
 
 /*
-    The hash container itself
+    Counters updated by the hash lookup functions when attached to a hash with
+    Container_SetHashCounters.  The counters are plain integers, so lookups made concurrently
+    from several threads may lose counts
+
+    Accessible members:
+        lookup_count  -- the number of node lookups made
+        found_count   -- the number of node lookups which found a node
+        compare_count -- the number of times a lookup function was invoked
+ */
+struct container__hash_counters
+{
+    unsigned long lookup_count;
+    unsigned long found_count;
+    unsigned long compare_count;
+};
+
+/*
+    The hash container itself.  When the index shift is zero, the bucket for a hash value is
+    selected by taking the hash value modulo the bucket count.  Otherwise the bucket count is
+    a power of two and the bucket is selected by multiplicative hashing, taking the high bits
+    of the product of the hash value and a large odd constant.  Lookups update the counters
+    only if counters have been attached.
+
+    The optional occupancy bitmap holds a bit per bucket so that hash scans may skip runs of
+    empty buckets.  Container_InsHashNode and Container_MergeHashBucket are given only a
+    bucket, so a bit is instead set whenever a bucket may gain a node: by an add, by
+    Container_LookupHashBucket, or by a lookup which found no node.  A node inserted into a
+    bucket which no such lookup of the same hash returned is missed by hash scans.  Bits are
+    only written while clear, so lookups of buckets already marked leave the bitmap untouched,
+    and are set atomically so that markers of buckets sharing a word don't lose each other's
+    bits.  Removing a node leaves its bit set, and hash scans clear the bits of empty buckets
+    as they find them, so nodes mustn't be added while a hash scan is in progress.  Since
+    lookups may still write to the bitmap, it mustn't be created for the hash of an shash,
+    whose lookups mark their bucket before taking its stripe.  Lookups by rhash readers never
+    touch the bitmap.
+
+    Accessible members:
+        alloc_type -- the way the buckets were allocated, which may differ from the way
+                      requested should huge pages be unavailable
+        allocator  -- the allocator used for the buckets and the occupancy bitmap
  */
 struct container__hash
 {
-    unsigned int                   bucket_count;
-    struct container__hash_bucket* buckets;
+    unsigned int                       bucket_count;
+    unsigned int                       index_shift;
+    struct container__hash_bucket*     buckets;
+    struct container__hash_counters*   counters;
+    unsigned long long*                occupancy;
+    enum container__hash_alloc_type    alloc_type;
+    void*                              alloc_address;
+    size_t                             alloc_size;
+    const struct container__allocator* allocator;
+};
+
+/*
+    The occupancy statistics of a hash, as reported by Container_HashStats
+
+    Accessible members:
+        node_count         -- the number of nodes in the hash
+        bucket_count       -- the number of buckets in the hash
+        empty_bucket_count -- the number of buckets with no nodes
+        max_chain_length   -- the number of nodes in the fullest bucket
+        load_factor        -- the number of nodes per bucket
+        mean_chain_length  -- the number of nodes per non-empty bucket, which is the mean
+                              number of nodes compared by a lookup which finds nothing
+        chain_histogram    -- the number of buckets holding each number of nodes
+ */
+struct container__hash_stats
+{
+    unsigned long node_count;
+    unsigned int  bucket_count;
+    unsigned int  empty_bucket_count;
+    unsigned int  max_chain_length;
+    double        load_factor;
+    double        mean_chain_length;
+    unsigned long chain_histogram[CONTAINER__HASH_HISTOGRAM_SIZE];
 };
 
 /*
@@ -98,6 +239,21 @@ struct container__hash_bucket_scan
     struct container__clist_scan node_scan;
 };
 
+/*
+    The scan structure used to scan every node of a hash
+
+    Accessible members:
+        current_node -- the current element node being visited
+        bucket_index -- the index of the bucket holding the current node
+ */
+struct container__hash_scan
+{
+    struct container__hash_node* current_node;
+    unsigned int                 bucket_index;
+
+    struct container__hash_bucket_scan bucket_scan;
+};
+
 
 /*
     The required type for a user-defined hash lookup function.
@@ -127,6 +283,97 @@ typedef enum container__hash_cmp_result
                                  void*
                                 );
 
+/*
+    The required type for a user-defined hash value function.  The value function is
+    responsible for recomputing the hash value of a node which has already been placed in
+    a hash, allowing the node to be moved between buckets
+
+    For example:
+        unsigned int
+        MyHashValue (struct container__hash_node* restrict node, void* user_data)
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(node, struct my_element, node);
+
+            return MyHash(element->my_id);
+        }
+ */
+typedef unsigned int
+(*container__hash_value_type) (struct container__hash_node* restrict, void*);
+
+/*
+    The type of one part of the work split up by a parallel hash function, invoked with the
+    index of the part
+ */
+typedef void
+(*container__hash_part_type) (unsigned int, void*);
+
+/*
+    The required type for a user-defined function which runs the parts of a parallel hash
+    function.  Each part index from zero up to the part count must be passed to the part
+    function along with the part data, and the run function must not return until every part
+    has completed.  The parts are independent, so they may run on as many threads as are
+    available
+
+    For example:
+        void
+        MyRunParts (
+                    unsigned int              part_count,
+                    container__hash_part_type part,
+                    void*                     part_data,
+                    void*                     user_data
+                   )
+        {
+            struct my_thread_pool* pool;
+
+            pool = user_data;
+
+            for(unsigned int part_index = 0; part_index < part_count; part_index++)
+                MyThreadPoolSubmit(pool, part, part_index, part_data);
+
+            MyThreadPoolWait(pool);
+        }
+ */
+typedef void
+(*container__hash_run_parts_type) (unsigned int, container__hash_part_type, void*, void*);
+
+
+/*
+    Describes how a parallel hash function splits up its work
+
+    Accessible members:
+        part_count -- the number of parts to split the buckets into, usually the thread count
+        run_parts  -- the function which runs the parts
+        user_data  -- the user data passed to the run function
+ */
+struct container__hash_parallel
+{
+    unsigned int                   part_count;
+    container__hash_run_parts_type run_parts;
+    void*                          user_data;
+};
+
+
+/*
+    The scan structure used to visit every node in a hash equal to a value, for hashes which
+    hold several nodes with the same key
+
+    Accessible members:
+        current_node -- the current equal node being visited
+        bucket       -- the bucket being scanned, which may be passed to Container_InsHashNode
+ */
+struct container__hash_equal_scan
+{
+    struct container__hash_node*   current_node;
+    struct container__hash_bucket* bucket;
+
+    void*                              value;
+    container__hash_lookup_type        lookup;
+    void*                              user_data;
+    struct container__hash_bucket_scan bucket_scan;
+};
+
 
 /*
      Initialize a hash.  The container will be empty upon initialization
@@ -141,6 +388,41 @@ Container_InitHash (
                     struct container__hash* restrict
                    );
 
+/*
+     Initialize a hash, splitting the initialization of the buckets into parts as described
+     by the parallel structure.  For very large hashes this lets the buckets be initialized at
+     the speed of memory rather than of a single core.  A NULL parallel structure initializes
+     the buckets on the calling thread, as with Container_InitHash
+
+     Syntax:
+         Container_InitHashParallel(bucket_count, my_buckets_array, &my_parallel, &my_hash);
+ */
+inline void
+Container_InitHashParallel (
+                            unsigned int,
+                            struct container__hash_bucket* restrict,
+                            const struct container__hash_parallel*,
+                            struct container__hash* restrict
+                           );
+
+/*
+     Initialize a hash with a power of two number of buckets, specified as the base 2 logarithm
+     of the bucket count.  Bucket selection then costs a multiply and a shift rather than a
+     division, and the multiply mixes the hash value so that hash values which differ only in
+     their high bits still spread across buckets.  The shift must be no larger than
+     CONTAINER__HASH_MAX_SHIFT, which is asserted.  The container will be empty upon
+     initialization
+
+     Syntax:
+         Container_InitHashShift(bucket_shift, my_buckets_array, &my_hash);
+ */
+inline void
+Container_InitHashShift (
+                         unsigned int,
+                         struct container__hash_bucket* restrict,
+                         struct container__hash* restrict
+                        );
+
 /*
      Allocate hash buckets and initialize a hash.  The container will be empty upon
      initialization
@@ -151,6 +433,132 @@ Container_InitHash (
 inline enum container__error_code
 Container_CreateHash (unsigned int, struct container__hash* restrict);
 
+/*
+     Allocate a power of two number of hash buckets, specified as the base 2 logarithm of the
+     bucket count, and initialize a hash as with Container_InitHashShift
+
+     Syntax:
+         Container_CreateHashShift(bucket_shift, &my_hash);
+ */
+inline enum container__error_code
+Container_CreateHashShift (unsigned int, struct container__hash* restrict);
+
+/*
+     Allocate hash buckets in the specified way and initialize a hash.  Aligned buckets start
+     on a cache line, and huge page buckets reduce TLB misses for large hashes.  The container
+     will be empty upon initialization
+
+     Syntax:
+         Container_CreateHashAlloc(bucket_count, container__hash_alloc_huge_pages, &my_hash);
+ */
+inline enum container__error_code
+Container_CreateHashAlloc (
+                           unsigned int,
+                           enum container__hash_alloc_type,
+                           struct container__hash* restrict
+                          );
+
+/*
+     Allocate a power of two number of hash buckets in the specified way, and initialize a hash
+     as with Container_InitHashShift
+
+     Syntax:
+         Container_CreateHashShiftAlloc(bucket_shift, container__hash_alloc_huge_pages, &my_hash);
+ */
+inline enum container__error_code
+Container_CreateHashShiftAlloc (
+                                unsigned int,
+                                enum container__hash_alloc_type,
+                                struct container__hash* restrict
+                               );
+
+/*
+     Allocate hash buckets in the specified way using an allocator, and initialize a hash.  The
+     allocator is also used for the occupancy bitmap and by Container_ResizeHash.  Huge page
+     buckets are always mapped directly, and the allocator is only used should mapping fail
+
+     Syntax:
+         Container_CreateHashWithAllocator(
+                                           bucket_count,
+                                           container__hash_alloc_aligned,
+                                           &my_allocator,
+                                           &my_hash
+                                          );
+ */
+inline enum container__error_code
+Container_CreateHashWithAllocator (
+                                   unsigned int,
+                                   enum container__hash_alloc_type,
+                                   const struct container__allocator*,
+                                   struct container__hash* restrict
+                                  );
+
+/*
+     Allocate a power of two number of hash buckets in the specified way using an allocator,
+     and initialize a hash as with Container_InitHashShift
+
+     Syntax:
+         Container_CreateHashShiftWithAllocator(
+                                                bucket_shift,
+                                                container__hash_alloc_default,
+                                                &my_allocator,
+                                                &my_hash
+                                               );
+ */
+inline enum container__error_code
+Container_CreateHashShiftWithAllocator (
+                                        unsigned int,
+                                        enum container__hash_alloc_type,
+                                        const struct container__allocator*,
+                                        struct container__hash* restrict
+                                       );
+
+/*
+     Allocate hash buckets as with Container_CreateHashWithAllocator, and initialize them in
+     parts as with Container_InitHashParallel.  Freshly mapped huge pages are also faulted in
+     by the threads running the parts
+
+     Syntax:
+         error = Container_CreateHashParallel(
+                                              bucket_count,
+                                              container__hash_alloc_huge_pages,
+                                              NULL,
+                                              &my_parallel,
+                                              &my_hash
+                                             );
+ */
+inline enum container__error_code
+Container_CreateHashParallel (
+                              unsigned int,
+                              enum container__hash_alloc_type,
+                              const struct container__allocator*,
+                              const struct container__hash_parallel*,
+                              struct container__hash* restrict
+                             );
+
+/*
+     Allocate a power of two number of hash buckets as with
+     Container_CreateHashShiftWithAllocator, and initialize them in parts as with
+     Container_InitHashParallel
+
+     Syntax:
+         error = Container_CreateHashShiftParallel(
+                                                   bucket_shift,
+                                                   container__hash_alloc_huge_pages,
+                                                   NULL,
+                                                   &my_parallel,
+                                                   &my_hash
+                                                  );
+ */
+inline enum container__error_code
+Container_CreateHashShiftParallel (
+                                   unsigned int,
+                                   enum container__hash_alloc_type,
+                                   const struct container__allocator*,
+                                   const struct container__hash_parallel*,
+                                   struct container__hash* restrict
+                                  );
+
 /*
      Cleanup a previously created hash
 
@@ -170,6 +578,149 @@ Container_DestroyHash (struct container__hash* restrict);
 inline void
 Container_ResetHash (struct container__hash* restrict);
 
+/*
+    Reset one part of a hash, for callers which split up a reset across their own threads.
+    The buckets and occupancy bitmap are divided into the specified number of parts, and the
+    hash is only reset once every part has been.  No other operation may be made on the hash
+    until then
+
+    Syntax:
+        Container_ResetHashPart(thread_index, thread_count, &my_hash);
+ */
+inline void
+Container_ResetHashPart (unsigned int, unsigned int, struct container__hash* restrict);
+
+/*
+    Reset a hash container to the initialized state, splitting the reset into parts as
+    described by the parallel structure
+
+    Syntax:
+        Container_ResetHashParallel(&my_parallel, &my_hash);
+ */
+inline void
+Container_ResetHashParallel (
+                             const struct container__hash_parallel*,
+                             struct container__hash* restrict
+                            );
+
+
+/*
+    Allocate an occupancy bitmap for a hash, which lets hash scans skip empty buckets.  The
+    bitmap reflects the nodes already in the hash, and it is resized along with the hash by
+    Container_ResizeHash.  Lookups which find no node mark their bucket in the bitmap, so it
+    isn't supported for the hash of an shash
+
+    Syntax:
+        error = Container_CreateHashOccupancy(&my_hash);
+ */
+inline enum container__error_code
+Container_CreateHashOccupancy (struct container__hash* restrict);
+
+/*
+    Cleanup a previously created occupancy bitmap.  This must be done before the hash is
+    destroyed
+
+    Syntax:
+        Container_DestroyHashOccupancy(&my_hash);
+ */
+inline void
+Container_DestroyHashOccupancy (struct container__hash* restrict);
+
+
+/*
+    Move every node from one hash into another, which may have a different bucket count.  The
+    value function is used to determine the hash value of each node.  The hash the nodes were
+    moved from is left empty
+
+    Syntax:
+        Container_RehashHash(&from_hash, &into_hash, &Container_CachedHashValue, NULL);
+ */
+inline void
+Container_RehashHash (
+                      struct container__hash* restrict,
+                      struct container__hash* restrict,
+                      container__hash_value_type,
+                      void*
+                     );
+
+/*
+    Allocate a new set of buckets for a previously created hash and move every node into them,
+    using the value function to determine the hash value of each node.  A hash created with a
+    power of two number of buckets keeps selecting buckets that way, with the new bucket count
+    rounded up to a power of two no larger than 2^CONTAINER__HASH_MAX_SHIFT.  The hash is left
+    unchanged should allocating the new buckets fail
+
+    Syntax:
+        error = Container_ResizeHash(new_bucket_count, &my_hash, &Container_CachedHashValue, NULL);
+ */
+inline enum container__error_code
+Container_ResizeHash (
+                      unsigned int,
+                      struct container__hash* restrict,
+                      container__hash_value_type,
+                      void*
+                     );
+
+/*
+    Move every node from one hash into another.  When both hashes have the same bucket count
+    and index shift, each bucket of the source is spliced onto the head of the matching bucket
+    of the destination without visiting its nodes.  Otherwise every node is rehashed using the
+    value function, which may be Container_CachedHashValue so that no user hash function is
+    invoked.  The hash the nodes were moved from is left empty
+
+    Syntax:
+        Container_MergeHash(&from_hash, &into_hash, &Container_CachedHashValue, NULL);
+ */
+inline void
+Container_MergeHash (
+                     struct container__hash* restrict,
+                     struct container__hash* restrict,
+                     container__hash_value_type,
+                     void*
+                    );
+
+/*
+    Move every node of one hash bucket onto the head of another, leaving the first bucket
+    empty.  The buckets must belong to hashes with the same bucket count and index shift, and
+    be at the same index, for the moved nodes to remain reachable by lookups.  Should the
+    destination hash have an occupancy bitmap, the destination bucket must have been returned
+    by Container_LookupHashBucket for the moved nodes to be visited by hash scans
+
+    Syntax:
+        Container_MergeHashBucket(&from_bucket, &into_bucket);
+ */
+inline void
+Container_MergeHashBucket (
+                           struct container__hash_bucket* restrict,
+                           struct container__hash_bucket* restrict
+                          );
+
+
+/*
+    Attach counters to a hash, resetting them to zero.  Passing NULL detaches any counters
+
+    Syntax:
+        Container_SetHashCounters(&my_counters, &my_hash);
+ */
+inline void
+Container_SetHashCounters (
+                           struct container__hash_counters* restrict,
+                           struct container__hash* restrict
+                          );
+
+/*
+    Walk every bucket of the hash and report its occupancy statistics.  No other thread may
+    modify the hash during the walk
+
+    Syntax:
+        Container_HashStats(&my_hash, &my_stats);
+ */
+inline void
+Container_HashStats (
+                     struct container__hash* restrict,
+                     struct container__hash_stats* restrict
+                    );
+
 
 /*
    Lookup the bucket which maps to the specified hash value
@@ -206,168 +757,1268 @@ Container_LookupHashNode (
 
 
 /*
-     Add a node to the hash, specifying the hash value for the node
+    Lookup a node in the hash as with Container_LookupHashNode, moving a found node to the head
+    of its bucket so that frequently found nodes are compared first.  The lookup modifies the
+    bucket, so it may not be made while the bucket is being scanned or read by another thread
 
-     Syntax:
-         Container_AddHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_hash);
+    Syntax:
+        found_node = Container_LookupHashNodeMoveFront(
+                                                       MyHashValue(lookup_id),
+                                                       &lookup_id,
+                                                       &my_hash,
+                                                       &MyLookup,
+                                                       my_user_data,
+                                                       &searched_bucket
+                                                      );
  */
-inline void
-Container_AddHashNode (
-                       unsigned int,
-                       struct container__hash_node* restrict,
-                       struct container__hash* restrict
-                      );
+inline struct container__hash_node*
+Container_LookupHashNodeMoveFront (
+                                   unsigned int,
+                                   void*,
+                                   struct container__hash* restrict,
+                                   container__hash_lookup_type,
+                                   void*,
+                                   struct container__hash_bucket** restrict
+                                  );
 
 /*
-    Insert a node into the specified hash bucket
+    Lookup a node in the hash as with Container_LookupHashNode, swapping a found node with the
+    node before it.  Frequently found nodes drift toward the head of their bucket more slowly
+    than with Container_LookupHashNodeMoveFront, but a single lookup of a rarely found node
+    can't displace the most frequently found node from the head.  The lookup modifies the
+    bucket, so it may not be made while the bucket is being scanned or read by another thread
 
     Syntax:
-        Container_InsHashNode(&my_element.node, &my_hash_bucket);
+        found_node = Container_LookupHashNodeTranspose(
+                                                       MyHashValue(lookup_id),
+                                                       &lookup_id,
+                                                       &my_hash,
+                                                       &MyLookup,
+                                                       my_user_data,
+                                                       &searched_bucket
+                                                      );
  */
-inline void
-Container_InsHashNode (
-                       struct container__hash_node* restrict,
-                       struct container__hash_bucket* restrict
-                      );
+inline struct container__hash_node*
+Container_LookupHashNodeTranspose (
+                                   unsigned int,
+                                   void*,
+                                   struct container__hash* restrict,
+                                   container__hash_lookup_type,
+                                   void*,
+                                   struct container__hash_bucket** restrict
+                                  );
+
 
 /*
-    Remove a node from the hash
+    Lookup a node in a hash made up of cached nodes.  The lookup function is only invoked for
+    nodes whose cached hash value matches the specified hash value.  Upon completion, the
+    bucket searched for the node will be set and the found node returned.  If no node was
+    found, NULL is returned
 
     Syntax:
-        Container_RemoveHashNode(&my_element.node);
+        found_node = Container_LookupCachedHashNode(
+                                                    MyHashValue(lookup_id),
+                                                    &lookup_id,
+                                                    &my_hash,
+                                                    &MyLookup,
+                                                    my_user_data,
+                                                    &searched_bucket
+                                                   );
  */
-inline void
-Container_RemoveHashNode (struct container__hash_node* restrict);
+inline struct container__hash_node*
+Container_LookupCachedHashNode (
+                                unsigned int,
+                                void*,
+                                struct container__hash* restrict,
+                                container__hash_lookup_type,
+                                void*,
+                                struct container__hash_bucket** restrict
+                               );
 
 
 /*
-    Start a scan of a particular hash bucket
+    Lookup a batch of nodes in the hash.  For each hash value and lookup value pair, the found
+    node, or NULL if no node was found, is stored at the same index of the found nodes array.
+    Lookups are performed in groups, first prefetching the bucket for every lookup in the group
+    and then the first node of each bucket before any lookup function is invoked.  This is
+    meant to let the cache misses of a group overlap rather than stall each lookup in turn.
+    Whether it is faster than looking up each node in turn depends on how many misses the
+    processor can keep outstanding, so measure it with bench_hash_batch before relying on it
 
     Syntax:
-        Container_StartHashBucketScan(&my_buckets[scan_bucket_index], &bucket_scan);
+        Container_LookupHashNodeBatch(
+                                      lookup_count,
+                                      lookup_hashes,
+                                      lookup_ids,
+                                      &my_hash,
+                                      &MyLookup,
+                                      my_user_data,
+                                      found_nodes
+                                     );
  */
 inline void
-Container_StartHashBucketScan (
-                               struct container__hash_bucket* restrict,
-                               struct container__hash_bucket_scan* restrict
+Container_LookupHashNodeBatch (
+                               unsigned int,
+                               const unsigned int* restrict,
+                               void* const* restrict,
+                               struct container__hash* restrict,
+                               container__hash_lookup_type,
+                               void*,
+                               struct container__hash_node** restrict
                               );
 
 
 /*
-    Resume a scan of a hash bucket
+     Add a node to the hash, specifying the hash value for the node
+
+     Syntax:
+         Container_AddHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_hash);
+ */
+inline void
+Container_AddHashNode (
+                       unsigned int,
+                       struct container__hash_node* restrict,
+                       struct container__hash* restrict
+                      );
+
+/*
+     Add a node to the hash, placing it directly before an existing node with an equal key
+     so that nodes with the same key remain adjacent within their bucket.  If no equal node
+     exists, the node is added as with Container_AddHashNode
+
+     Syntax:
+         Container_AddGroupedHashNode(
+                                      MyHashValue(my_element.my_id),
+                                      &my_element.my_id,
+                                      &my_element.node,
+                                      &my_hash,
+                                      &MyLookup,
+                                      my_user_data
+                                     );
+ */
+inline void
+Container_AddGroupedHashNode (
+                              unsigned int,
+                              void*,
+                              struct container__hash_node* restrict,
+                              struct container__hash* restrict,
+                              container__hash_lookup_type,
+                              void*
+                             );
+
+/*
+    Insert a node into the specified hash bucket.  Should the hash have an occupancy bitmap,
+    the bucket must have been returned by a lookup of the hash, which marks it in the bitmap
+
+    Syntax:
+        Container_InsHashNode(&my_element.node, &my_hash_bucket);
+ */
+inline void
+Container_InsHashNode (
+                       struct container__hash_node* restrict,
+                       struct container__hash_bucket* restrict
+                      );
+
+/*
+    Add a cached node to the hash, caching the specified hash value in the node
+
+    Syntax:
+        Container_AddCachedHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_hash);
+ */
+inline void
+Container_AddCachedHashNode (
+                             unsigned int,
+                             struct container__cached_hash_node* restrict,
+                             struct container__hash* restrict
+                            );
+
+/*
+    Insert a cached node into the specified hash bucket, caching the specified hash value in
+    the node
+
+    Syntax:
+        Container_InsCachedHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_bucket);
+ */
+inline void
+Container_InsCachedHashNode (
+                             unsigned int,
+                             struct container__cached_hash_node* restrict,
+                             struct container__hash_bucket* restrict
+                            );
+
+/*
+    Remove a node from the hash.  Cached nodes are removed by passing their hash node
+
+    Syntax:
+        Container_RemoveHashNode(&my_element.node);
+ */
+inline void
+Container_RemoveHashNode (struct container__hash_node* restrict);
+
+
+/*
+    A hash value function, for use with Container_RehashHash and similar functions, which
+    returns the hash value cached in a cached node
+
+    Syntax:
+        value_hash = Container_CachedHashValue(&my_element.node.node, NULL);
+ */
+inline unsigned int
+Container_CachedHashValue (struct container__hash_node* restrict, void*);
+
+
+/*
+    Start a scan of a particular hash bucket
+
+    Syntax:
+        Container_StartHashBucketScan(&my_buckets[scan_bucket_index], &bucket_scan);
+ */
+inline void
+Container_StartHashBucketScan (
+                               struct container__hash_bucket* restrict,
+                               struct container__hash_bucket_scan* restrict
+                              );
+
+
+/*
+    Resume a scan of a hash bucket
 
     Syntax:
         Container_ResumeHashBucketScan(&my_buckets[scan_bucket_index], &bucket_scan);
  */
 inline void
-Container_ResumeHashBucketScan (
-                                struct container__hash_bucket* restrict,
-                                struct container__hash_bucket_scan* restrict
-                               );
+Container_ResumeHashBucketScan (
+                                struct container__hash_bucket* restrict,
+                                struct container__hash_bucket_scan* restrict
+                               );
+
+/*
+    Return the state of a bucket scan
+
+    Syntax:
+        scan_state = Container_HashBucketScanState(&bucket_scan);
+ */
+inline enum container__hash_bucket_scan_state
+Container_HashBucketScanState (struct container__hash_bucket_scan* restrict);
+
+
+/*
+    Start a scan of every node in a hash.  Buckets are visited in index order, and with an
+    occupancy bitmap each run of 64 empty buckets is skipped by testing a single word
+
+    Syntax:
+        Container_StartHashScan(&my_hash, &hash_scan);
+ */
+inline void
+Container_StartHashScan (
+                         struct container__hash* restrict,
+                         struct container__hash_scan* restrict
+                        );
+
+/*
+    Resume a scan of every node in a hash
+
+    Syntax:
+        Container_ResumeHashScan(&my_hash, &hash_scan);
+ */
+inline void
+Container_ResumeHashScan (
+                          struct container__hash* restrict,
+                          struct container__hash_scan* restrict
+                         );
+
+/*
+    Return the state of a hash scan
+
+    Syntax:
+        scan_state = Container_HashScanState(&hash_scan);
+ */
+inline enum container__hash_scan_state
+Container_HashScanState (struct container__hash_scan* restrict);
+
+
+/*
+    Start a scan of every node in the hash equal to a value.  The scan stops at the first
+    equal node, and each resume continues the bucket walk from the last equal node, so
+    visiting every duplicate costs a single walk of the bucket
+
+    Syntax:
+        for(
+            Container_StartHashEqualScan(
+                                         MyHashValue(lookup_id),
+                                         &lookup_id,
+                                         &my_hash,
+                                         &MyLookup,
+                                         my_user_data,
+                                         &equal_scan
+                                        );
+            Container_HashEqualScanState(&equal_scan) != container__hash_equal_scan_finished;
+            Container_ResumeHashEqualScan(&my_hash, &equal_scan)
+           )
+        {
+            ...
+        }
+ */
+inline void
+Container_StartHashEqualScan (
+                              unsigned int,
+                              void*,
+                              struct container__hash* restrict,
+                              container__hash_lookup_type,
+                              void*,
+                              struct container__hash_equal_scan* restrict
+                             );
+
+/*
+    Resume a scan of the nodes equal to a value.  The current node may be removed from the
+    hash before the scan is resumed, provided it is not added to a hash again until then
+
+    Syntax:
+        Container_ResumeHashEqualScan(&my_hash, &equal_scan);
+ */
+inline void
+Container_ResumeHashEqualScan (
+                               struct container__hash* restrict,
+                               struct container__hash_equal_scan* restrict
+                              );
+
+/*
+    Return the state of a scan of the nodes equal to a value
+
+    Syntax:
+        scan_state = Container_HashEqualScanState(&equal_scan);
+ */
+inline enum container__hash_equal_scan_state
+Container_HashEqualScanState (struct container__hash_equal_scan* restrict);
+
+
+#include <container/utils.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+
+/*
+    Knuth's multiplicative hashing constant, 2^32 divided by the golden ratio
+ */
+#define CONTAINER__HASH_MULTIPLIER UINT32_C(2654435769)
+
+/*
+    The number of lookups whose memory accesses Container_LookupHashNodeBatch issues together
+ */
+#define CONTAINER__HASH_BATCH_GROUP_SIZE 16
+
+/*
+    The number of buckets tracked by each word of an occupancy bitmap
+ */
+#define CONTAINER__HASH_OCCUPANCY_BITS 64
+
+
+/*
+    The part data passed to Container_ResetHashTask
+ */
+struct container__hash_reset_task
+{
+    unsigned int            part_count;
+    struct container__hash* hash;
+};
+
+
+inline void
+Container_ResetHashTask (unsigned int, void*);
+
+inline unsigned int
+Container_HashBucketIndex (unsigned int, struct container__hash* restrict);
+
+inline void
+Container_CountHashLookup (
+                           unsigned int,
+                           struct container__hash_node* restrict,
+                           struct container__hash* restrict
+                          );
+
+inline struct container__hash_bucket*
+Container_MapHashBuckets (size_t, struct container__hash* restrict);
+
+inline struct container__hash_bucket*
+Container_AllocHashBuckets (
+                            unsigned int,
+                            enum container__hash_alloc_type,
+                            struct container__hash* restrict
+                           );
+
+inline unsigned int
+Container_HashOccupancyWords (unsigned int);
+
+inline unsigned int
+Container_LowestHashOccupancyBit (unsigned long long);
+
+inline void
+Container_MarkHashBucket (unsigned int, struct container__hash* restrict);
+
+inline unsigned int
+Container_FindHashBucket (unsigned int, struct container__hash* restrict);
+
+inline void
+Container_StartHashScanBucket (
+                               unsigned int,
+                               struct container__hash* restrict,
+                               struct container__hash_scan* restrict
+                              );
+
+inline unsigned int
+Container_UpdateHashEqualScan (struct container__hash_equal_scan* restrict);
+
+inline void
+Container_UpdateHashBucketScan (
+                                struct container__hash_bucket* restrict,
+                                struct container__hash_bucket_scan* restrict
+                               );
+
+
+inline void
+Container_ResetHashTask (unsigned int part_index, void* part_data)
+{
+    struct container__hash_reset_task* task;
+
+    task = part_data;
+
+    Container_ResetHashPart(part_index, task->part_count, task->hash);
+}
+
+inline unsigned int
+Container_HashBucketIndex (unsigned int value_hash, struct container__hash* restrict hash)
+{
+    uint32_t mixed_hash;
+
+    if(hash->index_shift == 0)
+        return value_hash%hash->bucket_count;
+
+    mixed_hash = (uint32_t)value_hash*CONTAINER__HASH_MULTIPLIER;
+
+    return mixed_hash>>hash->index_shift;
+}
+
+inline void
+Container_CountHashLookup (
+                           unsigned int                          compare_count,
+                           struct container__hash_node* restrict found_node,
+                           struct container__hash* restrict      hash
+                          )
+{
+    struct container__hash_counters* counters;
+
+    counters = hash->counters;
+    if(counters == NULL)
+        return;
+
+    counters->lookup_count++;
+    counters->compare_count += compare_count;
+
+    if(found_node != NULL)
+        counters->found_count++;
+}
+
+inline struct container__hash_bucket*
+Container_MapHashBuckets (size_t alloc_size, struct container__hash* restrict hash)
+{
+#if defined(__linux__) && defined(MAP_ANONYMOUS)
+    size_t map_size;
+    char*  address;
+
+    map_size = (alloc_size+CONTAINER__HASH_HUGE_PAGE_SIZE-1)&~(CONTAINER__HASH_HUGE_PAGE_SIZE-1);
+
+#if defined(MAP_HUGETLB)
+    address = mmap(
+                   NULL,
+                   map_size,
+                   PROT_READ|PROT_WRITE,
+                   MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB,
+                   -1,
+                   0
+                  );
+    if(address != MAP_FAILED)
+    {
+        hash->alloc_address = address;
+        hash->alloc_size    = map_size;
+
+        return (struct container__hash_bucket*)address;
+    }
+#endif
+
+#if defined(MADV_HUGEPAGE)
+    /*
+        Transparent huge pages only back huge page aligned ranges, so map an extra huge page
+        and trim the unaligned ends
+     */
+    address = mmap(
+                   NULL,
+                   map_size+CONTAINER__HASH_HUGE_PAGE_SIZE,
+                   PROT_READ|PROT_WRITE,
+                   MAP_PRIVATE|MAP_ANONYMOUS,
+                   -1,
+                   0
+                  );
+    if(address != MAP_FAILED)
+    {
+        char*  aligned_address;
+        size_t head_size;
+
+        aligned_address = (void*)(((uintptr_t)address+CONTAINER__HASH_HUGE_PAGE_SIZE-1)&
+                                  ~(uintptr_t)(CONTAINER__HASH_HUGE_PAGE_SIZE-1));
+        head_size       = aligned_address-address;
+
+        if(head_size > 0)
+            munmap(address, head_size);
+
+        munmap(aligned_address+map_size, CONTAINER__HASH_HUGE_PAGE_SIZE-head_size);
+
+        madvise(aligned_address, map_size, MADV_HUGEPAGE);
+
+        hash->alloc_address = aligned_address;
+        hash->alloc_size    = map_size;
+
+        return (struct container__hash_bucket*)aligned_address;
+    }
+#endif
+#endif
+
+    return NULL;
+}
+
+inline struct container__hash_bucket*
+Container_AllocHashBuckets (
+                            unsigned int                     count,
+                            enum container__hash_alloc_type  alloc_type,
+                            struct container__hash* restrict hash
+                           )
+{
+    struct container__hash_bucket* buckets;
+    size_t                         alloc_size;
+    char*                          address;
+
+    alloc_size = sizeof(struct container__hash_bucket)*count;
+
+    if(alloc_type == container__hash_alloc_huge_pages)
+    {
+        buckets = Container_MapHashBuckets(alloc_size, hash);
+        if(buckets != NULL)
+        {
+            hash->alloc_type = container__hash_alloc_huge_pages;
+
+            return buckets;
+        }
+
+        alloc_type = container__hash_alloc_aligned;
+    }
+
+    if(alloc_type == container__hash_alloc_default)
+    {
+        buckets = Container_AllocMemory(alloc_size, hash->allocator);
+
+        hash->alloc_type    = container__hash_alloc_default;
+        hash->alloc_address = buckets;
+        hash->alloc_size    = alloc_size;
+
+        return buckets;
+    }
+
+    alloc_size += CONTAINER__HASH_CACHE_LINE_SIZE-1;
+
+    address = Container_AllocMemory(alloc_size, hash->allocator);
+    if(address == NULL)
+        return NULL;
+
+    buckets = (void*)(((uintptr_t)address+CONTAINER__HASH_CACHE_LINE_SIZE-1)&
+                      ~(uintptr_t)(CONTAINER__HASH_CACHE_LINE_SIZE-1));
+
+    hash->alloc_type    = container__hash_alloc_aligned;
+    hash->alloc_address = address;
+    hash->alloc_size    = alloc_size;
+
+    return buckets;
+}
+
+inline unsigned int
+Container_HashOccupancyWords (unsigned int bucket_count)
+{
+    return (bucket_count+CONTAINER__HASH_OCCUPANCY_BITS-1)/CONTAINER__HASH_OCCUPANCY_BITS;
+}
+
+inline unsigned int
+Container_LowestHashOccupancyBit (unsigned long long word)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctzll(word);
+#else
+    unsigned int bit;
+
+    for(bit = 0; (word&1) == 0; bit++)
+        word >>= 1;
+
+    return bit;
+#endif
+}
+
+inline void
+Container_MarkHashBucket (unsigned int bucket_index, struct container__hash* restrict hash)
+{
+    unsigned long long* word;
+    unsigned long long  bit;
+
+    if(hash->occupancy == NULL)
+        return;
+
+    word = &hash->occupancy[bucket_index/CONTAINER__HASH_OCCUPANCY_BITS];
+    bit  = 1ull<<(bucket_index%CONTAINER__HASH_OCCUPANCY_BITS);
+
+    /*
+        Testing the bit first keeps repeated lookups of a marked bucket from writing to the
+        shared word
+     */
+    if((__atomic_load_n(word, __ATOMIC_RELAXED)&bit) == 0)
+        __atomic_fetch_or(word, bit, __ATOMIC_RELAXED);
+}
+
+inline unsigned int
+Container_FindHashBucket (unsigned int bucket_index, struct container__hash* restrict hash)
+{
+    struct container__hash_bucket* buckets;
+    unsigned long long*            occupancy;
+    unsigned int                   count;
+    unsigned int                   word_count;
+
+    buckets   = hash->buckets;
+    occupancy = hash->occupancy;
+    count     = hash->bucket_count;
+
+    if(occupancy == NULL)
+    {
+        while(bucket_index < count)
+        {
+            if(Container_CListState(&buckets[bucket_index].node_list) != container__clist_empty)
+                break;
+
+            bucket_index++;
+        }
+
+        return bucket_index;
+    }
+
+    word_count = Container_HashOccupancyWords(count);
+
+    while(bucket_index < count)
+    {
+        unsigned int       word_index;
+        unsigned long long word;
+
+        word_index = bucket_index/CONTAINER__HASH_OCCUPANCY_BITS;
+        word       = __atomic_load_n(&occupancy[word_index], __ATOMIC_RELAXED)&
+                     (~0ull<<(bucket_index%CONTAINER__HASH_OCCUPANCY_BITS));
+
+        while(word == 0)
+        {
+            word_index++;
+            if(word_index == word_count)
+                return count;
+
+            word = __atomic_load_n(&occupancy[word_index], __ATOMIC_RELAXED);
+        }
+
+        bucket_index = word_index*CONTAINER__HASH_OCCUPANCY_BITS+
+                       Container_LowestHashOccupancyBit(word);
+
+        if(Container_CListState(&buckets[bucket_index].node_list) != container__clist_empty)
+            return bucket_index;
+
+        __atomic_fetch_and(
+                           &occupancy[word_index],
+                           ~(1ull<<(bucket_index%CONTAINER__HASH_OCCUPANCY_BITS)),
+                           __ATOMIC_RELAXED
+                          );
+
+        bucket_index++;
+    }
+
+    return count;
+}
+
+inline void
+Container_StartHashScanBucket (
+                               unsigned int                          bucket_index,
+                               struct container__hash* restrict      hash,
+                               struct container__hash_scan* restrict scan
+                              )
+{
+    scan->bucket_index = Container_FindHashBucket(bucket_index, hash);
+    if(scan->bucket_index == hash->bucket_count)
+    {
+        scan->current_node = NULL;
+
+        return;
+    }
+
+    Container_StartHashBucketScan(&hash->buckets[scan->bucket_index], &scan->bucket_scan);
+
+    scan->current_node = scan->bucket_scan.current_node;
+}
+
+inline unsigned int
+Container_UpdateHashEqualScan (struct container__hash_equal_scan* restrict scan)
+{
+    unsigned int compare_count;
+
+    compare_count = 0;
+
+    for(
+        ;
+        Container_HashBucketScanState(&scan->bucket_scan) != container__hash_bucket_scan_finished;
+        Container_ResumeHashBucketScan(scan->bucket, &scan->bucket_scan)
+       )
+    {
+        enum container__hash_cmp_result result;
+
+        compare_count++;
+
+        result = (*scan->lookup)(scan->value, scan->bucket_scan.current_node, scan->user_data);
+        if(result == container__hash_node_equal)
+            break;
+    }
+
+    scan->current_node = scan->bucket_scan.current_node;
+
+    return compare_count;
+}
+
+inline void
+Container_UpdateHashBucketScan (
+                                struct container__hash_bucket* restrict      bucket,
+                                struct container__hash_bucket_scan* restrict scan
+                               )
+{
+    enum container__clist_scan_state state;
+
+    state = Container_CListScanState(&bucket->node_list, &scan->node_scan);
+    if(state == container__clist_scan_incomplete)
+    {
+        scan->current_node = CONTAINER__CONTAINER_OF(
+                                                     scan->node_scan.current_node,
+                                                     struct container__hash_node,
+                                                     node
+                                                    );
+    }
+    else
+        scan->current_node = NULL;
+}
+
+
+inline void
+Container_InitHash (
+                    unsigned int                            count,
+                    struct container__hash_bucket* restrict buckets,
+                    struct container__hash* restrict        hash
+                   )
+{
+    Container_InitHashParallel(count, buckets, NULL, hash);
+}
+
+inline void
+Container_InitHashParallel (
+                            unsigned int                            count,
+                            struct container__hash_bucket* restrict buckets,
+                            const struct container__hash_parallel*  parallel,
+                            struct container__hash* restrict        hash
+                           )
+{
+    hash->bucket_count = count;
+    hash->index_shift  = 0;
+    hash->buckets      = buckets;
+    hash->counters     = NULL;
+    hash->occupancy    = NULL;
+
+    hash->alloc_type    = container__hash_alloc_default;
+    hash->alloc_address = buckets;
+    hash->alloc_size    = sizeof(struct container__hash_bucket)*count;
+    hash->allocator     = NULL;
+
+    Container_ResetHashParallel(parallel, hash);
+}
+
+inline void
+Container_InitHashShift (
+                         unsigned int                            shift,
+                         struct container__hash_bucket* restrict buckets,
+                         struct container__hash* restrict        hash
+                        )
+{
+    assert(shift <= CONTAINER__HASH_MAX_SHIFT);
+
+    Container_InitHash(1u<<shift, buckets, hash);
+
+    if(shift > 0)
+        hash->index_shift = 32-shift;
+}
+
+inline enum container__error_code
+Container_CreateHash (unsigned int count, struct container__hash* restrict hash)
+{
+    return Container_CreateHashAlloc(count, container__hash_alloc_default, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashShift (unsigned int shift, struct container__hash* restrict hash)
+{
+    return Container_CreateHashShiftAlloc(shift, container__hash_alloc_default, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashAlloc (
+                           unsigned int                     count,
+                           enum container__hash_alloc_type  alloc_type,
+                           struct container__hash* restrict hash
+                          )
+{
+    return Container_CreateHashWithAllocator(count, alloc_type, NULL, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashShiftAlloc (
+                                unsigned int                     shift,
+                                enum container__hash_alloc_type  alloc_type,
+                                struct container__hash* restrict hash
+                               )
+{
+    return Container_CreateHashShiftWithAllocator(shift, alloc_type, NULL, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashWithAllocator (
+                                   unsigned int                       count,
+                                   enum container__hash_alloc_type    alloc_type,
+                                   const struct container__allocator* allocator,
+                                   struct container__hash* restrict   hash
+                                  )
+{
+    return Container_CreateHashParallel(count, alloc_type, allocator, NULL, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashShiftWithAllocator (
+                                        unsigned int                       shift,
+                                        enum container__hash_alloc_type    alloc_type,
+                                        const struct container__allocator* allocator,
+                                        struct container__hash* restrict   hash
+                                       )
+{
+    return Container_CreateHashShiftParallel(shift, alloc_type, allocator, NULL, hash);
+}
+
+inline enum container__error_code
+Container_CreateHashParallel (
+                              unsigned int                           count,
+                              enum container__hash_alloc_type        alloc_type,
+                              const struct container__allocator*     allocator,
+                              const struct container__hash_parallel* parallel,
+                              struct container__hash* restrict       hash
+                             )
+{
+    struct container__hash         alloc_hash;
+    struct container__hash_bucket* buckets;
+
+    alloc_hash.allocator = allocator;
+
+    buckets = Container_AllocHashBuckets(count, alloc_type, &alloc_hash);
+    if(buckets == NULL)
+        return container__error_memory_alloc;
+
+    Container_InitHashParallel(count, buckets, parallel, hash);
+
+    hash->alloc_type    = alloc_hash.alloc_type;
+    hash->alloc_address = alloc_hash.alloc_address;
+    hash->alloc_size    = alloc_hash.alloc_size;
+    hash->allocator     = allocator;
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_CreateHashShiftParallel (
+                                   unsigned int                           shift,
+                                   enum container__hash_alloc_type        alloc_type,
+                                   const struct container__allocator*     allocator,
+                                   const struct container__hash_parallel* parallel,
+                                   struct container__hash* restrict       hash
+                                  )
+{
+    enum container__error_code error;
+
+    if(shift > CONTAINER__HASH_MAX_SHIFT)
+        return container__error_resource_unavailable;
+
+    error = Container_CreateHashParallel(1u<<shift, alloc_type, allocator, parallel, hash);
+    if(error != container__error_none)
+        return error;
+
+    if(shift > 0)
+        hash->index_shift = 32-shift;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyHash (struct container__hash* restrict hash)
+{
+#if defined(__linux__)
+    if(hash->alloc_type == container__hash_alloc_huge_pages)
+    {
+        munmap(hash->alloc_address, hash->alloc_size);
+
+        return;
+    }
+#endif
+
+    Container_FreeMemory(hash->alloc_address, hash->alloc_size, hash->allocator);
+}
+
+inline void
+Container_ResetHash (struct container__hash* restrict hash)
+{
+    Container_ResetHashPart(0, 1, hash);
+}
+
+inline void
+Container_ResetHashPart (
+                         unsigned int                     part_index,
+                         unsigned int                     part_count,
+                         struct container__hash* restrict hash
+                        )
+{
+    struct container__hash_bucket* buckets;
+    unsigned int                   index;
+    unsigned int                   end;
+
+    buckets = hash->buckets;
+    index   = (unsigned int)((unsigned long long)hash->bucket_count*part_index/part_count);
+    end     = (unsigned int)((unsigned long long)hash->bucket_count*(part_index+1)/part_count);
+
+    for(; index < end; index++)
+        Container_ResetCList(&buckets[index].node_list);
+
+    if(hash->occupancy != NULL)
+    {
+        unsigned int word_count;
+
+        word_count = Container_HashOccupancyWords(hash->bucket_count);
+        index      = (unsigned int)((unsigned long long)word_count*part_index/part_count);
+        end        = (unsigned int)((unsigned long long)word_count*(part_index+1)/part_count);
+
+        for(; index < end; index++)
+            hash->occupancy[index] = 0;
+    }
+}
+
+inline void
+Container_ResetHashParallel (
+                             const struct container__hash_parallel* parallel,
+                             struct container__hash* restrict       hash
+                            )
+{
+    struct container__hash_reset_task task;
+
+    if(parallel == NULL || parallel->part_count <= 1)
+    {
+        Container_ResetHash(hash);
+
+        return;
+    }
+
+    task.part_count = parallel->part_count;
+    task.hash       = hash;
+
+    (*parallel->run_parts)(
+                           parallel->part_count,
+                           &Container_ResetHashTask,
+                           &task,
+                           parallel->user_data
+                          );
+}
+
+inline enum container__error_code
+Container_CreateHashOccupancy (struct container__hash* restrict hash)
+{
+    unsigned long long* occupancy;
+    unsigned int        index;
+
+    occupancy = Container_AllocZeroMemory(
+                                          sizeof(*occupancy)*
+                                          Container_HashOccupancyWords(hash->bucket_count),
+                                          hash->allocator
+                                         );
+    if(occupancy == NULL)
+        return container__error_memory_alloc;
+
+    hash->occupancy = occupancy;
+
+    for(index = 0; index < hash->bucket_count; index++)
+    {
+        if(Container_CListState(&hash->buckets[index].node_list) != container__clist_empty)
+            Container_MarkHashBucket(index, hash);
+    }
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyHashOccupancy (struct container__hash* restrict hash)
+{
+    Container_FreeMemory(
+                         hash->occupancy,
+                         sizeof(*hash->occupancy)*Container_HashOccupancyWords(hash->bucket_count),
+                         hash->allocator
+                        );
+
+    hash->occupancy = NULL;
+}
+
+inline void
+Container_RehashHash (
+                      struct container__hash* restrict source,
+                      struct container__hash* restrict dest,
+                      container__hash_value_type       value,
+                      void*                            user_data
+                     )
+{
+    struct container__hash_bucket* buckets;
+    unsigned int                   count;
 
-/*
-    Return the state of a bucket scan
+    buckets = source->buckets;
+    count   = source->bucket_count;
 
-    Syntax:
-        scan_state = Container_HashBucketScanState(&bucket_scan);
- */
-inline enum container__hash_bucket_scan_state
-Container_HashBucketScanState (struct container__hash_bucket_scan* restrict);
+    while(count-- > 0)
+    {
+        struct container__clist_node* sentinel;
+        struct container__clist_node* list_node;
+        struct container__clist_node* next_node;
 
+        sentinel = &buckets[count].node_list.sentinel;
+        for(list_node = sentinel->next; list_node != sentinel; list_node = next_node)
+        {
+            struct container__hash_node* hash_node;
 
-#include <container/utils.h>
+            next_node = list_node->next;
+            hash_node = CONTAINER__CONTAINER_OF(list_node, struct container__hash_node, node);
 
-#include <stddef.h>
-#include <stdlib.h>
+            Container_AddHashNode((*value)(hash_node, user_data), hash_node, dest);
+        }
 
+        Container_ResetCList(&buckets[count].node_list);
+    }
 
-inline void
-Container_UpdateHashBucketScan (
-                                struct container__hash_bucket* restrict,
-                                struct container__hash_bucket_scan* restrict
-                               );
+    if(source->occupancy != NULL)
+    {
+        count = Container_HashOccupancyWords(source->bucket_count);
 
+        while(count-- > 0)
+            source->occupancy[count] = 0;
+    }
+}
 
-inline void
-Container_UpdateHashBucketScan (
-                                struct container__hash_bucket* restrict      bucket,
-                                struct container__hash_bucket_scan* restrict scan
-                               )
+inline enum container__error_code
+Container_ResizeHash (
+                      unsigned int                     count,
+                      struct container__hash* restrict hash,
+                      container__hash_value_type       value,
+                      void*                            user_data
+                     )
 {
-    enum container__clist_scan_state state;
+    struct container__hash     new_hash;
+    enum container__error_code error;
 
-    state = Container_CListScanState(&bucket->node_list, &scan->node_scan);
-    if(state == container__clist_scan_incomplete)
+    if(hash->index_shift != 0)
     {
-        scan->current_node = CONTAINER__CONTAINER_OF(
-                                                     scan->node_scan.current_node,
-                                                     struct container__hash_node,
-                                                     node
-                                                    );
+        unsigned int shift;
+
+        shift = 0;
+        while(shift < CONTAINER__HASH_MAX_SHIFT && (1u<<shift) < count)
+            shift++;
+
+        error = Container_CreateHashShiftWithAllocator(
+                                                       shift,
+                                                       hash->alloc_type,
+                                                       hash->allocator,
+                                                       &new_hash
+                                                      );
     }
     else
-        scan->current_node = NULL;
-}
+    {
+        error = Container_CreateHashWithAllocator(
+                                                  count,
+                                                  hash->alloc_type,
+                                                  hash->allocator,
+                                                  &new_hash
+                                                 );
+    }
 
+    if(error != container__error_none)
+        return error;
 
-inline void
-Container_InitHash (
-                    unsigned int                            count,
-                    struct container__hash_bucket* restrict buckets,
-                    struct container__hash* restrict        hash
-                   )
-{
-    hash->bucket_count = count;
-    hash->buckets      = buckets;
+    if(hash->occupancy != NULL)
+    {
+        error = Container_CreateHashOccupancy(&new_hash);
+        if(error != container__error_none)
+        {
+            Container_DestroyHash(&new_hash);
 
-    while(count-- > 0)
-        Container_InitCList(&buckets[count].node_list);
+            return error;
+        }
+    }
+
+    Container_RehashHash(hash, &new_hash, value, user_data);
+    Container_DestroyHashOccupancy(hash);
+    Container_DestroyHash(hash);
+
+    new_hash.counters = hash->counters;
+
+    *hash = new_hash;
+
+    return container__error_none;
 }
 
-inline enum container__error_code
-Container_CreateHash (unsigned int count, struct container__hash* restrict hash)
+inline void
+Container_MergeHash (
+                     struct container__hash* restrict source,
+                     struct container__hash* restrict dest,
+                     container__hash_value_type       value,
+                     void*                            user_data
+                    )
 {
-    struct container__hash_bucket* buckets;
-    size_t                         alloc_size;
+    unsigned int index;
 
-    alloc_size = sizeof(struct container__hash_bucket)*count;
-    buckets    = malloc(alloc_size);
-    if(buckets == NULL)
-        return container__error_memory_alloc;
+    if(source->bucket_count != dest->bucket_count || source->index_shift != dest->index_shift)
+    {
+        Container_RehashHash(source, dest, value, user_data);
 
-    Container_InitHash(count, buckets, hash);
+        return;
+    }
 
-    return container__error_none;
+    for(index = 0; index < source->bucket_count; index++)
+    {
+        struct container__hash_bucket* source_bucket;
+
+        source_bucket = &source->buckets[index];
+        if(Container_CListState(&source_bucket->node_list) == container__clist_empty)
+            continue;
+
+        Container_MergeHashBucket(source_bucket, &dest->buckets[index]);
+        Container_MarkHashBucket(index, dest);
+    }
+
+    if(source->occupancy != NULL)
+    {
+        index = Container_HashOccupancyWords(source->bucket_count);
+
+        while(index-- > 0)
+            source->occupancy[index] = 0;
+    }
 }
 
 inline void
-Container_DestroyHash (struct container__hash* restrict hash)
+Container_MergeHashBucket (
+                           struct container__hash_bucket* restrict source,
+                           struct container__hash_bucket* restrict dest
+                          )
 {
-    free(hash->buckets);
+    Container_MergeCListHead(&source->node_list, &dest->node_list);
+    Container_ResetCList(&source->node_list);
 }
 
 inline void
-Container_ResetHash (struct container__hash* restrict hash)
+Container_SetHashCounters (
+                           struct container__hash_counters* restrict counters,
+                           struct container__hash* restrict          hash
+                          )
 {
+    if(counters != NULL)
+    {
+        counters->lookup_count  = 0;
+        counters->found_count   = 0;
+        counters->compare_count = 0;
+    }
 
-    struct container__hash_bucket* buckets;
-    unsigned int                   count;
+    hash->counters = counters;
+}
 
-    buckets = hash->buckets;
-    count   = hash->bucket_count;
+inline void
+Container_HashStats (
+                     struct container__hash* restrict       hash,
+                     struct container__hash_stats* restrict stats
+                    )
+{
+    unsigned int index;
 
-    while(count-- > 0)
-        Container_ResetCList(&buckets[count].node_list);
+    stats->node_count         = 0;
+    stats->bucket_count       = hash->bucket_count;
+    stats->empty_bucket_count = 0;
+    stats->max_chain_length   = 0;
+
+    for(index = 0; index < CONTAINER__HASH_HISTOGRAM_SIZE; index++)
+        stats->chain_histogram[index] = 0;
+
+    for(index = 0; index < hash->bucket_count; index++)
+    {
+        struct container__clist_node* sentinel;
+        struct container__clist_node* list_node;
+        unsigned int                  chain_length;
+
+        sentinel     = &hash->buckets[index].node_list.sentinel;
+        chain_length = 0;
+
+        for(list_node = sentinel->next; list_node != sentinel; list_node = list_node->next)
+            chain_length++;
+
+        if(chain_length == 0)
+            stats->empty_bucket_count++;
+
+        if(chain_length > stats->max_chain_length)
+            stats->max_chain_length = chain_length;
+
+        if(chain_length < CONTAINER__HASH_HISTOGRAM_SIZE)
+            stats->chain_histogram[chain_length]++;
+        else
+            stats->chain_histogram[CONTAINER__HASH_HISTOGRAM_SIZE-1]++;
+
+        stats->node_count += chain_length;
+    }
+
+    stats->load_factor       = 0;
+    stats->mean_chain_length = 0;
+
+    if(stats->bucket_count > 0)
+        stats->load_factor = (double)stats->node_count/stats->bucket_count;
+
+    if(stats->empty_bucket_count < stats->bucket_count)
+    {
+        stats->mean_chain_length = (double)stats->node_count/
+                                   (stats->bucket_count-stats->empty_bucket_count);
+    }
 }
 
 inline struct container__hash_bucket*
 Container_LookupHashBucket (unsigned int value_hash, struct container__hash* restrict hash)
 {
     struct container__hash_bucket* hash_bucket;
+    unsigned int                   bucket_index;
 
-    value_hash %= hash->bucket_count;
+    bucket_index = Container_HashBucketIndex(value_hash, hash);
+    hash_bucket  = &hash->buckets[bucket_index];
 
-    hash_bucket = &hash->buckets[value_hash];
+    Container_MarkHashBucket(bucket_index, hash);
 
     return hash_bucket;
 }
@@ -384,11 +2035,15 @@ Container_LookupHashNode (
 {
     struct container__hash_bucket_scan scan;
     struct container__hash_bucket*     hash_bucket;
+    struct container__hash_node*       found_node;
+    unsigned int                       bucket_index;
+    unsigned int                       compare_count;
 
-    value_hash %= hash->bucket_count;
-
-    hash_bucket      = &hash->buckets[value_hash];
+    bucket_index     = Container_HashBucketIndex(value_hash, hash);
+    hash_bucket      = &hash->buckets[bucket_index];
     *searched_bucket = hash_bucket;
+    found_node       = NULL;
+    compare_count    = 0;
 
     for(
         Container_StartHashBucketScan(hash_bucket, &scan);
@@ -398,12 +2053,222 @@ Container_LookupHashNode (
     {
         enum container__hash_cmp_result result;
 
+        compare_count++;
+
         result = (*lookup)(value, scan.current_node, user_data);
         if(result == container__hash_node_equal)
-            return scan.current_node;
+        {
+            found_node = scan.current_node;
+
+            break;
+        }
     }
 
-    return NULL;
+    if(found_node == NULL)
+        Container_MarkHashBucket(bucket_index, hash);
+
+    Container_CountHashLookup(compare_count, found_node, hash);
+
+    return found_node;
+}
+
+inline struct container__hash_node*
+Container_LookupHashNodeMoveFront (
+                                   unsigned int                             value_hash,
+                                   void*                                    value,
+                                   struct container__hash* restrict         hash,
+                                   container__hash_lookup_type              lookup,
+                                   void*                                    user_data,
+                                   struct container__hash_bucket** restrict searched_bucket
+                                  )
+{
+    struct container__hash_node* found_node;
+    struct container__clist*     node_list;
+
+    found_node = Container_LookupHashNode(
+                                          value_hash,
+                                          value,
+                                          hash,
+                                          lookup,
+                                          user_data,
+                                          searched_bucket
+                                         );
+    if(found_node == NULL)
+        return NULL;
+
+    node_list = &(*searched_bucket)->node_list;
+    if(node_list->sentinel.next != &found_node->node)
+    {
+        Container_RemoveCListNode(&found_node->node);
+        Container_AddCListHead(&found_node->node, node_list);
+    }
+
+    return found_node;
+}
+
+inline struct container__hash_node*
+Container_LookupHashNodeTranspose (
+                                   unsigned int                             value_hash,
+                                   void*                                    value,
+                                   struct container__hash* restrict         hash,
+                                   container__hash_lookup_type              lookup,
+                                   void*                                    user_data,
+                                   struct container__hash_bucket** restrict searched_bucket
+                                  )
+{
+    struct container__hash_node*  found_node;
+    struct container__clist_node* prev_node;
+
+    found_node = Container_LookupHashNode(
+                                          value_hash,
+                                          value,
+                                          hash,
+                                          lookup,
+                                          user_data,
+                                          searched_bucket
+                                         );
+    if(found_node == NULL)
+        return NULL;
+
+    prev_node = found_node->node.prev;
+    if(prev_node != &(*searched_bucket)->node_list.sentinel)
+    {
+        Container_RemoveCListNode(&found_node->node);
+        Container_PrependCListNode(&found_node->node, prev_node);
+    }
+
+    return found_node;
+}
+
+inline struct container__hash_node*
+Container_LookupCachedHashNode (
+                                unsigned int                             value_hash,
+                                void*                                    value,
+                                struct container__hash* restrict         hash,
+                                container__hash_lookup_type              lookup,
+                                void*                                    user_data,
+                                struct container__hash_bucket** restrict searched_bucket
+                               )
+{
+    struct container__hash_bucket_scan scan;
+    struct container__hash_bucket*     hash_bucket;
+    struct container__hash_node*       found_node;
+    unsigned int                       bucket_index;
+    unsigned int                       compare_count;
+
+    bucket_index     = Container_HashBucketIndex(value_hash, hash);
+    hash_bucket      = &hash->buckets[bucket_index];
+    *searched_bucket = hash_bucket;
+    found_node       = NULL;
+    compare_count    = 0;
+
+    for(
+        Container_StartHashBucketScan(hash_bucket, &scan);
+        Container_HashBucketScanState(&scan) != container__hash_bucket_scan_finished;
+        Container_ResumeHashBucketScan(hash_bucket, &scan)
+       )
+    {
+        struct container__cached_hash_node* cached_node;
+        enum container__hash_cmp_result     result;
+
+        cached_node = CONTAINER__CONTAINER_OF(
+                                              scan.current_node,
+                                              struct container__cached_hash_node,
+                                              node
+                                             );
+        if(cached_node->value_hash != value_hash)
+            continue;
+
+        compare_count++;
+
+        result = (*lookup)(value, scan.current_node, user_data);
+        if(result == container__hash_node_equal)
+        {
+            found_node = scan.current_node;
+
+            break;
+        }
+    }
+
+    if(found_node == NULL)
+        Container_MarkHashBucket(bucket_index, hash);
+
+    Container_CountHashLookup(compare_count, found_node, hash);
+
+    return found_node;
+}
+
+inline void
+Container_LookupHashNodeBatch (
+                               unsigned int                           count,
+                               const unsigned int* restrict           value_hashes,
+                               void* const* restrict                  values,
+                               struct container__hash* restrict       hash,
+                               container__hash_lookup_type            lookup,
+                               void*                                  user_data,
+                               struct container__hash_node** restrict found_nodes
+                              )
+{
+    struct container__hash_bucket* group_buckets[CONTAINER__HASH_BATCH_GROUP_SIZE];
+    unsigned int                   group_start;
+
+    for(group_start = 0; group_start < count; group_start += CONTAINER__HASH_BATCH_GROUP_SIZE)
+    {
+        unsigned int group_count;
+        unsigned int index;
+
+        group_count = count-group_start;
+        if(group_count > CONTAINER__HASH_BATCH_GROUP_SIZE)
+            group_count = CONTAINER__HASH_BATCH_GROUP_SIZE;
+
+        for(index = 0; index < group_count; index++)
+        {
+            unsigned int bucket_index;
+
+            bucket_index         = Container_HashBucketIndex(value_hashes[group_start+index], hash);
+            group_buckets[index] = &hash->buckets[bucket_index];
+
+            CONTAINER__PREFETCH(group_buckets[index]);
+        }
+
+        for(index = 0; index < group_count; index++)
+            CONTAINER__PREFETCH(group_buckets[index]->node_list.sentinel.next);
+
+        for(index = 0; index < group_count; index++)
+        {
+            struct container__hash_bucket_scan scan;
+            struct container__hash_bucket*     hash_bucket;
+            struct container__hash_node*       found_node;
+            unsigned int                       compare_count;
+
+            hash_bucket   = group_buckets[index];
+            found_node    = NULL;
+            compare_count = 0;
+
+            for(
+                Container_StartHashBucketScan(hash_bucket, &scan);
+                Container_HashBucketScanState(&scan) != container__hash_bucket_scan_finished;
+                Container_ResumeHashBucketScan(hash_bucket, &scan)
+               )
+            {
+                enum container__hash_cmp_result result;
+
+                compare_count++;
+
+                result = (*lookup)(values[group_start+index], scan.current_node, user_data);
+                if(result == container__hash_node_equal)
+                {
+                    found_node = scan.current_node;
+
+                    break;
+                }
+            }
+
+            found_nodes[group_start+index] = found_node;
+
+            Container_CountHashLookup(compare_count, found_node, hash);
+        }
+    }
 }
 
 inline void
@@ -420,6 +2285,29 @@ Container_AddHashNode (
     Container_AddCListHead(&node->node, &hash_bucket->node_list);
 }
 
+inline void
+Container_AddGroupedHashNode (
+                              unsigned int                          value_hash,
+                              void*                                 value,
+                              struct container__hash_node* restrict node,
+                              struct container__hash* restrict      hash,
+                              container__hash_lookup_type           lookup,
+                              void*                                 user_data
+                             )
+{
+    struct container__hash_equal_scan scan;
+
+    Container_StartHashEqualScan(value_hash, value, hash, lookup, user_data, &scan);
+    if(scan.current_node == NULL)
+    {
+        Container_AddCListHead(&node->node, &scan.bucket->node_list);
+
+        return;
+    }
+
+    Container_PrependCListNode(&node->node, &scan.current_node->node);
+}
+
 inline void
 Container_InsHashNode (
                        struct container__hash_node* restrict   node,
@@ -429,12 +2317,46 @@ Container_InsHashNode (
     Container_AddCListHead(&node->node, &bucket->node_list);
 }
 
+inline void
+Container_AddCachedHashNode (
+                             unsigned int                                 value_hash,
+                             struct container__cached_hash_node* restrict node,
+                             struct container__hash* restrict             hash
+                            )
+{
+    node->value_hash = value_hash;
+
+    Container_AddHashNode(value_hash, &node->node, hash);
+}
+
+inline void
+Container_InsCachedHashNode (
+                             unsigned int                                 value_hash,
+                             struct container__cached_hash_node* restrict node,
+                             struct container__hash_bucket* restrict      bucket
+                            )
+{
+    node->value_hash = value_hash;
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
 inline void
 Container_RemoveHashNode (struct container__hash_node* restrict node)
 {
     Container_RemoveCListNode(&node->node);
 }
 
+inline unsigned int
+Container_CachedHashValue (struct container__hash_node* restrict node, void* user_data)
+{
+    struct container__cached_hash_node* cached_node;
+
+    cached_node = CONTAINER__CONTAINER_OF(node, struct container__cached_hash_node, node);
+
+    return cached_node->value_hash;
+}
+
 inline enum container__hash_bucket_state
 Container_HashBucketState (struct container__hash_bucket* restrict bucket)
 {
@@ -476,5 +2398,93 @@ Container_HashBucketScanState (struct container__hash_bucket_scan* restrict scan
     return container__hash_bucket_scan_incomplete;
 }
 
+inline void
+Container_StartHashScan (
+                         struct container__hash* restrict      hash,
+                         struct container__hash_scan* restrict scan
+                        )
+{
+    Container_StartHashScanBucket(0, hash, scan);
+}
+
+inline void
+Container_ResumeHashScan (
+                          struct container__hash* restrict      hash,
+                          struct container__hash_scan* restrict scan
+                         )
+{
+    struct container__hash_bucket* hash_bucket;
+
+    hash_bucket = &hash->buckets[scan->bucket_index];
+
+    Container_ResumeHashBucketScan(hash_bucket, &scan->bucket_scan);
+
+    scan->current_node = scan->bucket_scan.current_node;
+    if(scan->current_node == NULL)
+        Container_StartHashScanBucket(scan->bucket_index+1, hash, scan);
+}
+
+inline enum container__hash_scan_state
+Container_HashScanState (struct container__hash_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__hash_scan_finished;
+
+    return container__hash_scan_incomplete;
+}
+
+inline void
+Container_StartHashEqualScan (
+                              unsigned int                                value_hash,
+                              void*                                       value,
+                              struct container__hash* restrict            hash,
+                              container__hash_lookup_type                 lookup,
+                              void*                                       user_data,
+                              struct container__hash_equal_scan* restrict scan
+                             )
+{
+    unsigned int bucket_index;
+    unsigned int compare_count;
+
+    bucket_index = Container_HashBucketIndex(value_hash, hash);
+
+    scan->bucket    = &hash->buckets[bucket_index];
+    scan->value     = value;
+    scan->lookup    = lookup;
+    scan->user_data = user_data;
+
+    Container_StartHashBucketScan(scan->bucket, &scan->bucket_scan);
+
+    compare_count = Container_UpdateHashEqualScan(scan);
+    if(scan->current_node == NULL)
+        Container_MarkHashBucket(bucket_index, hash);
+
+    Container_CountHashLookup(compare_count, scan->current_node, hash);
+}
+
+inline void
+Container_ResumeHashEqualScan (
+                               struct container__hash* restrict            hash,
+                               struct container__hash_equal_scan* restrict scan
+                              )
+{
+    unsigned int compare_count;
+
+    Container_ResumeHashBucketScan(scan->bucket, &scan->bucket_scan);
+
+    compare_count = Container_UpdateHashEqualScan(scan);
+    if(hash->counters != NULL)
+        hash->counters->compare_count += compare_count;
+}
+
+inline enum container__hash_equal_scan_state
+Container_HashEqualScanState (struct container__hash_equal_scan* restrict scan)
+{
+    if(scan->current_node == NULL)
+        return container__hash_equal_scan_finished;
+
+    return container__hash_equal_scan_incomplete;
+}
+
 
 #endif
@@ -0,0 +1,311 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    Hash functions for use with the hash containers.  The 32 bit integer functions are
+    invertible mixers, so distinct int and unsigned int keys never collide before bucket
+    selection.  The 64 bit integer functions mix the whole key and then truncate the result to
+    32 bits, so distinct long long keys may collide, though every bit of the key still affects
+    every bit of the result.  The byte and string functions follow the XXH64 design, consuming
+    a 64 bit word at a time with four independent lanes for longer inputs, and take a seed so
+    that tables exposed to untrusted keys may each use a different seed.  Results depend on the
+    byte order of the machine, so they should not be stored or shared
+ */
+
+
+#ifndef _CONTAINER__HASHFN_H_
+#define _CONTAINER__HASHFN_H_
+
+
+#include <stddef.h>
+
+
+/*
+    The seed used by the convenience functions which don't take one
+ */
+#define CONTAINER__HASHFN_DEFAULT_SEED 0u
+
+
+/*
+    Return the hash value of an int
+
+    Syntax:
+        value_hash = Container_HashInt(my_int);
+ */
+inline unsigned int
+Container_HashInt (int);
+
+/*
+    Return the hash value of an unsigned int
+
+    Syntax:
+        value_hash = Container_HashUInt(my_uint);
+ */
+inline unsigned int
+Container_HashUInt (unsigned int);
+
+/*
+    Return the hash value of a long long, truncated from a 64 bit mix of the key
+
+    Syntax:
+        value_hash = Container_HashLong(my_long);
+ */
+inline unsigned int
+Container_HashLong (long long);
+
+/*
+    Return the hash value of an unsigned long long, truncated from a 64 bit mix of the key
+
+    Syntax:
+        value_hash = Container_HashULong(my_ulong);
+ */
+inline unsigned int
+Container_HashULong (unsigned long long);
+
+/*
+    Return the hash value of an array of bytes, mixing in the specified seed
+
+    Syntax:
+        value_hash = Container_HashBytes(my_bytes, my_bytes_length, my_seed);
+ */
+inline unsigned int
+Container_HashBytes (const void* restrict, size_t, unsigned int);
+
+/*
+    Return the hash value of a null terminated string, mixing in the specified seed
+
+    Syntax:
+        value_hash = Container_HashString(my_string, my_seed);
+ */
+inline unsigned int
+Container_HashString (const char* restrict, unsigned int);
+
+
+#include <stdint.h>
+#include <string.h>
+
+
+#define CONTAINER__HASHFN_PRIME_1 UINT64_C(0x9E3779B185EBCA87)
+#define CONTAINER__HASHFN_PRIME_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define CONTAINER__HASHFN_PRIME_3 UINT64_C(0x165667B19E3779F9)
+#define CONTAINER__HASHFN_PRIME_4 UINT64_C(0x85EBCA77C2B2AE63)
+#define CONTAINER__HASHFN_PRIME_5 UINT64_C(0x27D4EB2F165667C5)
+
+
+inline uint64_t
+Container_HashRotate (uint64_t, unsigned int);
+
+inline uint64_t
+Container_HashRead64 (const unsigned char* restrict);
+
+inline uint32_t
+Container_HashRead32 (const unsigned char* restrict);
+
+inline uint64_t
+Container_HashRound (uint64_t, uint64_t);
+
+inline uint64_t
+Container_HashMergeRound (uint64_t, uint64_t);
+
+inline uint64_t
+Container_HashAvalanche (uint64_t);
+
+
+inline uint64_t
+Container_HashRotate (uint64_t value, unsigned int bits)
+{
+    return (value<<bits)|(value>>(64-bits));
+}
+
+inline uint64_t
+Container_HashRead64 (const unsigned char* restrict bytes)
+{
+    uint64_t word;
+
+    memcpy(&word, bytes, sizeof(word));
+
+    return word;
+}
+
+inline uint32_t
+Container_HashRead32 (const unsigned char* restrict bytes)
+{
+    uint32_t word;
+
+    memcpy(&word, bytes, sizeof(word));
+
+    return word;
+}
+
+inline uint64_t
+Container_HashRound (uint64_t accumulator, uint64_t word)
+{
+    accumulator += word*CONTAINER__HASHFN_PRIME_2;
+    accumulator  = Container_HashRotate(accumulator, 31);
+    accumulator *= CONTAINER__HASHFN_PRIME_1;
+
+    return accumulator;
+}
+
+inline uint64_t
+Container_HashMergeRound (uint64_t accumulator, uint64_t lane)
+{
+    accumulator ^= Container_HashRound(0, lane);
+    accumulator  = accumulator*CONTAINER__HASHFN_PRIME_1+CONTAINER__HASHFN_PRIME_4;
+
+    return accumulator;
+}
+
+inline uint64_t
+Container_HashAvalanche (uint64_t value)
+{
+    value ^= value>>33;
+    value *= CONTAINER__HASHFN_PRIME_2;
+    value ^= value>>29;
+    value *= CONTAINER__HASHFN_PRIME_3;
+    value ^= value>>32;
+
+    return value;
+}
+
+
+inline unsigned int
+Container_HashInt (int value)
+{
+    return Container_HashUInt((unsigned int)value);
+}
+
+inline unsigned int
+Container_HashUInt (unsigned int value)
+{
+    uint32_t mixed;
+
+    mixed  = value;
+    mixed ^= mixed>>16;
+    mixed *= UINT32_C(0x7FEB352D);
+    mixed ^= mixed>>15;
+    mixed *= UINT32_C(0x846CA68B);
+    mixed ^= mixed>>16;
+
+    return mixed;
+}
+
+inline unsigned int
+Container_HashLong (long long value)
+{
+    return Container_HashULong((unsigned long long)value);
+}
+
+inline unsigned int
+Container_HashULong (unsigned long long value)
+{
+    uint64_t mixed;
+
+    mixed  = value;
+    mixed ^= mixed>>30;
+    mixed *= UINT64_C(0xBF58476D1CE4E5B9);
+    mixed ^= mixed>>27;
+    mixed *= UINT64_C(0x94D049BB133111EB);
+    mixed ^= mixed>>31;
+
+    return (unsigned int)mixed;
+}
+
+inline unsigned int
+Container_HashBytes (const void* restrict bytes, size_t length, unsigned int seed)
+{
+    const unsigned char* current;
+    const unsigned char* end;
+    uint64_t             hash;
+
+    current = bytes;
+    end     = current+length;
+
+    if(length >= 32)
+    {
+        const unsigned char* limit;
+        uint64_t             lane_1;
+        uint64_t             lane_2;
+        uint64_t             lane_3;
+        uint64_t             lane_4;
+
+        limit  = end-32;
+        lane_1 = seed+CONTAINER__HASHFN_PRIME_1+CONTAINER__HASHFN_PRIME_2;
+        lane_2 = seed+CONTAINER__HASHFN_PRIME_2;
+        lane_3 = seed;
+        lane_4 = seed-CONTAINER__HASHFN_PRIME_1;
+
+        do
+        {
+            lane_1 = Container_HashRound(lane_1, Container_HashRead64(current));
+            lane_2 = Container_HashRound(lane_2, Container_HashRead64(current+8));
+            lane_3 = Container_HashRound(lane_3, Container_HashRead64(current+16));
+            lane_4 = Container_HashRound(lane_4, Container_HashRead64(current+24));
+
+            current += 32;
+        } while(current <= limit);
+
+        hash = Container_HashRotate(lane_1, 1)+Container_HashRotate(lane_2, 7)+
+               Container_HashRotate(lane_3, 12)+Container_HashRotate(lane_4, 18);
+
+        hash = Container_HashMergeRound(hash, lane_1);
+        hash = Container_HashMergeRound(hash, lane_2);
+        hash = Container_HashMergeRound(hash, lane_3);
+        hash = Container_HashMergeRound(hash, lane_4);
+    }
+    else
+    {
+        hash = seed+CONTAINER__HASHFN_PRIME_5;
+    }
+
+    hash += length;
+
+    for(; current+8 <= end; current += 8)
+    {
+        hash ^= Container_HashRound(0, Container_HashRead64(current));
+        hash  = Container_HashRotate(hash, 27)*CONTAINER__HASHFN_PRIME_1+CONTAINER__HASHFN_PRIME_4;
+    }
+
+    if(current+4 <= end)
+    {
+        hash ^= (uint64_t)Container_HashRead32(current)*CONTAINER__HASHFN_PRIME_1;
+        hash  = Container_HashRotate(hash, 23)*CONTAINER__HASHFN_PRIME_2+CONTAINER__HASHFN_PRIME_3;
+
+        current += 4;
+    }
+
+    for(; current < end; current++)
+    {
+        hash ^= *current*CONTAINER__HASHFN_PRIME_5;
+        hash  = Container_HashRotate(hash, 11)*CONTAINER__HASHFN_PRIME_1;
+    }
+
+    return (unsigned int)Container_HashAvalanche(hash);
+}
+
+inline unsigned int
+Container_HashString (const char* restrict string, unsigned int seed)
+{
+    return Container_HashBytes(string, strlen(string), seed);
+}
+
+
+#endif
@@ -0,0 +1,239 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    Generates hash functions specialized for a single element type.  The generated functions
+    compute the hash value of each key and compare keys directly, rather than through a lookup
+    function pointer, so the compiler is free to inline both into the bucket walk.  The
+    generated functions operate on an ordinary hash, and may be mixed with the functions in
+    hash.h on the same hash
+ */
+
+
+#ifndef _CONTAINER__HASHGEN_H_
+#define _CONTAINER__HASHGEN_H_
+
+
+#include <container/hash.h>
+#include <container/utils.h>
+
+#include <stddef.h>
+
+
+/*
+    Define static inline Add, Ins, Lookup and Remove functions for an element type holding a
+    key and a hash node.  Each function is named by the prefix, the operation and the name.
+    The hash function takes a key and returns its hash value, and the test function takes two
+    keys and returns a container__hash_cmp_result.  Both may be functions or function-like
+    macros
+
+    For example:
+        struct my_element
+        {
+            int my_id;
+
+            struct container__hash_node node;
+        };
+
+        CONTAINER__DEFINE_HASH(
+                               My,
+                               IdHash,
+                               struct my_element,
+                               node,
+                               int,
+                               my_id,
+                               Container_HashInt,
+                               Container_IntHashTest
+                              )
+
+    Defines:
+        void
+        MyAddIdHash (int, struct my_element* restrict, struct container__hash* restrict);
+
+        void
+        MyInsIdHash (int, struct my_element* restrict, struct container__hash_bucket* restrict);
+
+        struct my_element*
+        MyLookupIdHash (
+                        int,
+                        struct container__hash* restrict,
+                        struct container__hash_bucket** restrict
+                       );
+
+        void
+        MyRemoveIdHash (struct my_element* restrict);
+
+    The Add and Ins functions store the key in the element before adding it, and the Lookup
+    function returns NULL if no element was found, setting the searched bucket as with
+    Container_LookupHashNode
+ */
+#define CONTAINER__DEFINE_HASH(prefix, name, elem_type, node_member, key_type, key_member, hash_fn, test_fn) \
+    CONTAINER__DEFINE_HASH_LINKAGE(                                                                 \
+                                   static inline,                                                   \
+                                   prefix,                                                          \
+                                   name,                                                            \
+                                   elem_type,                                                       \
+                                   node_member,                                                     \
+                                   key_type,                                                        \
+                                   key_member,                                                      \
+                                   hash_fn,                                                         \
+                                   test_fn                                                          \
+                                  )
+
+/*
+    Define Add, Ins, Lookup and Remove functions as with CONTAINER__DEFINE_HASH, but as inline
+    functions with external linkage, as the functions of the container headers are.  This
+    suits a library header whose functions are exported.  Exactly one translation unit must
+    also use CONTAINER__DECLARE_EXTERN_HASH with the same arguments, which makes it provide the
+    external definitions
+
+    For example:
+        CONTAINER__DEFINE_EXTERN_HASH(
+                                      My,
+                                      IdHash,
+                                      struct my_element,
+                                      node,
+                                      int,
+                                      my_id,
+                                      Container_HashInt,
+                                      Container_IntHashTest
+                                     )
+ */
+#define CONTAINER__DEFINE_EXTERN_HASH(prefix, name, elem_type, node_member, key_type, key_member, hash_fn, test_fn) \
+    CONTAINER__DEFINE_HASH_LINKAGE(                                                                 \
+                                   inline,                                                          \
+                                   prefix,                                                          \
+                                   name,                                                            \
+                                   elem_type,                                                       \
+                                   node_member,                                                     \
+                                   key_type,                                                        \
+                                   key_member,                                                      \
+                                   hash_fn,                                                         \
+                                   test_fn                                                          \
+                                  )
+
+/*
+    Declare the functions defined by CONTAINER__DEFINE_EXTERN_HASH as extern, so that the
+    translation unit using it provides their external definitions
+
+    For example:
+        CONTAINER__DECLARE_EXTERN_HASH(My, IdHash, struct my_element, int);
+ */
+#define CONTAINER__DECLARE_EXTERN_HASH(prefix, name, elem_type, key_type)                           \
+    extern void                                                                                     \
+    prefix##Add##name (key_type, elem_type* restrict, struct container__hash* restrict);            \
+                                                                                                    \
+    extern void                                                                                     \
+    prefix##Ins##name (key_type, elem_type* restrict, struct container__hash_bucket* restrict);     \
+                                                                                                    \
+    extern elem_type*                                                                               \
+    prefix##Lookup##name (                                                                          \
+                          key_type,                                                                 \
+                          struct container__hash* restrict,                                         \
+                          struct container__hash_bucket** restrict                                  \
+                         );                                                                         \
+                                                                                                    \
+    extern void                                                                                     \
+    prefix##Remove##name (elem_type* restrict)
+
+
+#define CONTAINER__DEFINE_HASH_LINKAGE(linkage, prefix, name, elem_type, node_member, key_type, key_member, hash_fn, test_fn) \
+    linkage void                                                                                    \
+    prefix##Add##name (                                                                             \
+                       key_type                         key,                                        \
+                       elem_type* restrict              element,                                    \
+                       struct container__hash* restrict hash                                        \
+                      )                                                                             \
+    {                                                                                               \
+        element->key_member = key;                                                                  \
+                                                                                                    \
+        Container_AddHashNode(hash_fn(key), &element->node_member, hash);                           \
+    }                                                                                               \
+                                                                                                    \
+    linkage void                                                                                    \
+    prefix##Ins##name (                                                                             \
+                       key_type                                key,                                 \
+                       elem_type* restrict                     element,                             \
+                       struct container__hash_bucket* restrict bucket                               \
+                      )                                                                             \
+    {                                                                                               \
+        element->key_member = key;                                                                  \
+                                                                                                    \
+        Container_InsHashNode(&element->node_member, bucket);                                       \
+    }                                                                                               \
+                                                                                                    \
+    linkage elem_type*                                                                              \
+    prefix##Lookup##name (                                                                          \
+                          key_type                                 key,                             \
+                          struct container__hash* restrict         hash,                            \
+                          struct container__hash_bucket** restrict searched_bucket                  \
+                         )                                                                          \
+    {                                                                                               \
+        struct container__hash_bucket* hash_bucket;                                                 \
+        struct container__clist_node*  sentinel;                                                    \
+        struct container__clist_node*  list_node;                                                   \
+        elem_type*                     found_element;                                               \
+        unsigned int                   bucket_index;                                                \
+        unsigned int                   compare_count;                                               \
+                                                                                                    \
+        bucket_index     = Container_HashBucketIndex(hash_fn(key), hash);                           \
+        hash_bucket      = &hash->buckets[bucket_index];                                            \
+        *searched_bucket = hash_bucket;                                                             \
+        sentinel         = &hash_bucket->node_list.sentinel;                                        \
+        found_element    = NULL;                                                                    \
+        compare_count    = 0;                                                                       \
+                                                                                                    \
+        for(list_node = sentinel->next; list_node != sentinel; list_node = list_node->next)         \
+        {                                                                                           \
+            elem_type* element;                                                                     \
+                                                                                                    \
+            compare_count++;                                                                        \
+                                                                                                    \
+            element = CONTAINER__CONTAINER_OF(list_node, elem_type, node_member.node);              \
+            if(test_fn(key, element->key_member) == container__hash_node_equal)                     \
+            {                                                                                       \
+                found_element = element;                                                            \
+                                                                                                    \
+                break;                                                                              \
+            }                                                                                       \
+        }                                                                                           \
+                                                                                                    \
+        if(found_element == NULL)                                                                   \
+        {                                                                                           \
+            Container_MarkHashBucket(bucket_index, hash);                                           \
+            Container_CountHashLookup(compare_count, NULL, hash);                                   \
+                                                                                                    \
+            return NULL;                                                                            \
+        }                                                                                           \
+                                                                                                    \
+        Container_CountHashLookup(compare_count, &found_element->node_member, hash);                \
+                                                                                                    \
+        return found_element;                                                                       \
+    }                                                                                               \
+                                                                                                    \
+    linkage void                                                                                    \
+    prefix##Remove##name (elem_type* restrict element)                                              \
+    {                                                                                               \
+        Container_RemoveHashNode(&element->node_member);                                            \
+    }
+
+
+#endif
@@ -0,0 +1,464 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The intern container keeps a single copy of each distinct string it is given, and returns
+    a handle to that copy.  Handles are pointers to the null terminated copies themselves, so
+    two handles are equal exactly when their strings are, and may be used directly as strings.
+    Copies are packed into large chunks which are never moved or released until the container
+    is destroyed, so handles remain valid for the life of the container.  Strings are found with
+    a single probe of a hash of cached nodes, and a string not yet interned is added to the
+    bucket that probe searched
+ */
+
+
+#ifndef _CONTAINER__INTERN_H_
+#define _CONTAINER__INTERN_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/hash.h>
+#include <container/stdhash.h>
+
+#include <stddef.h>
+
+
+/*
+    The size of each chunk of string storage.  Strings too large to share a chunk are given a
+    chunk of their own
+ */
+#define CONTAINER__INTERN_CHUNK_SIZE ((size_t)64*1024)
+
+/*
+    The number of strings per bucket beyond which the hash is grown
+ */
+#define CONTAINER__INTERN_MAX_LOAD 2
+
+
+/*
+    A chunk of string storage, followed directly by the strings stored in it
+ */
+struct container__intern_chunk
+{
+    struct container__intern_chunk* next;
+    size_t                          size;
+};
+
+/*
+    The copy of an interned string, which the string's handle points into
+ */
+struct container__intern_string
+{
+    struct container__cached_hash_node node;
+    size_t                             length;
+    char                               string[];
+};
+
+/*
+    The intern container itself
+
+    Accessible members:
+        string_count -- the number of distinct strings interned
+        string_size  -- the total length of the distinct strings interned
+        chunk_count  -- the number of chunks of string storage
+        allocator    -- the allocator used for the chunks and the hash
+ */
+struct container__intern
+{
+    struct container__hash             hash;
+    struct container__intern_chunk*    chunks;
+    char*                              free_space;
+    size_t                             free_size;
+    size_t                             string_count;
+    size_t                             string_size;
+    size_t                             chunk_count;
+    const struct container__allocator* allocator;
+};
+
+
+/*
+    Create an intern container, with the specified initial number of hash buckets.  The hash
+    is grown as strings are interned
+
+    Syntax:
+        error = Container_CreateIntern(bucket_count, &my_intern);
+ */
+inline enum container__error_code
+Container_CreateIntern (unsigned int, struct container__intern* restrict);
+
+/*
+    Create an intern container using an allocator for its string storage and hash buckets
+
+    Syntax:
+        error = Container_CreateInternWithAllocator(bucket_count, &my_allocator, &my_intern);
+ */
+inline enum container__error_code
+Container_CreateInternWithAllocator (
+                                     unsigned int,
+                                     const struct container__allocator*,
+                                     struct container__intern* restrict
+                                    );
+
+/*
+    Cleanup a previously created intern container, releasing every interned string.  No
+    handle may be used once the container is destroyed
+
+    Syntax:
+        Container_DestroyIntern(&my_intern);
+ */
+inline void
+Container_DestroyIntern (struct container__intern* restrict);
+
+
+/*
+    Intern a string of the specified length, which need not be null terminated.  The handle of
+    the string is returned through the handle pointer, copying the string into the container
+    if it hasn't been interned before
+
+    Syntax:
+        error = Container_InternString(my_string, my_string_length, &my_handle, &my_intern);
+ */
+inline enum container__error_code
+Container_InternString (
+                        const char*,
+                        size_t,
+                        const char** restrict,
+                        struct container__intern* restrict
+                       );
+
+/*
+    Return the handle of a string of the specified length, or NULL if the string hasn't been
+    interned.  The string is never added to the container
+
+    Syntax:
+        handle = Container_FindInternString(my_string, my_string_length, &my_intern);
+ */
+inline const char*
+Container_FindInternString (const char*, size_t, struct container__intern* restrict);
+
+/*
+    Return the length of an interned string from its handle
+
+    Syntax:
+        length = Container_InternStringLength(handle);
+ */
+inline size_t
+Container_InternStringLength (const char*);
+
+/*
+    Return the hash value of an interned string from its handle, as computed by
+    Container_HashBytes, so that handles may be added to other hashes without hashing their
+    strings again
+
+    Syntax:
+        value_hash = Container_InternStringHash(handle);
+ */
+inline unsigned int
+Container_InternStringHash (const char*);
+
+
+#include <container/utils.h>
+
+#include <string.h>
+
+
+/*
+    Every copy starts on a boundary suitable for its hash node
+ */
+#define CONTAINER__INTERN_ALIGNMENT sizeof(void*)
+
+
+inline struct container__intern_string*
+Container_InternStringOf (const char*);
+
+inline enum container__hash_cmp_result
+Container_InternLookup (void*, struct container__hash_node* restrict, void*);
+
+inline struct container__intern_string*
+Container_AllocInternString (size_t, struct container__intern* restrict);
+
+inline void
+Container_GrowIntern (struct container__intern* restrict);
+
+
+inline struct container__intern_string*
+Container_InternStringOf (const char* handle)
+{
+    return CONTAINER__CONTAINER_OF(handle, struct container__intern_string, string);
+}
+
+inline enum container__hash_cmp_result
+Container_InternLookup (
+                        void*                                 lookup_value,
+                        struct container__hash_node* restrict existing_node,
+                        void*                                 user_data
+                       )
+{
+    struct container__string_key* restrict    key;
+    struct container__intern_string* restrict existing_string;
+
+    key             = lookup_value;
+    existing_string = CONTAINER__CONTAINER_OF(
+                                              existing_node,
+                                              struct container__intern_string,
+                                              node.node
+                                             );
+
+    if(existing_string->length != key->length)
+        return container__hash_node_not_equal;
+
+    if(memcmp(existing_string->string, key->string, key->length) != 0)
+        return container__hash_node_not_equal;
+
+    return container__hash_node_equal;
+}
+
+inline struct container__intern_string*
+Container_AllocInternString (size_t length, struct container__intern* restrict intern)
+{
+    struct container__intern_string* intern_string;
+    size_t                           size;
+
+    size = offsetof(struct container__intern_string, string)+length+1;
+    size = (size+CONTAINER__INTERN_ALIGNMENT-1)&~(CONTAINER__INTERN_ALIGNMENT-1);
+
+    if(size > intern->free_size)
+    {
+        struct container__intern_chunk* chunk;
+        size_t                           chunk_size;
+
+        /*
+            A string larger than a quarter of a chunk gets a chunk of its own, so that the
+            space left in the current chunk isn't abandoned for it
+         */
+        chunk_size = sizeof(struct container__intern_chunk)+size;
+        if(size <= CONTAINER__INTERN_CHUNK_SIZE/4)
+            chunk_size = CONTAINER__INTERN_CHUNK_SIZE;
+
+        chunk = Container_AllocMemory(chunk_size, intern->allocator);
+        if(chunk == NULL)
+            return NULL;
+
+        chunk->next    = intern->chunks;
+        chunk->size    = chunk_size;
+        intern->chunks = chunk;
+
+        intern->chunk_count++;
+
+        if(size > CONTAINER__INTERN_CHUNK_SIZE/4)
+            return (struct container__intern_string*)(chunk+1);
+
+        intern->free_space = (char*)(chunk+1);
+        intern->free_size  = chunk_size-sizeof(struct container__intern_chunk);
+    }
+
+    intern_string = (struct container__intern_string*)intern->free_space;
+
+    intern->free_space += size;
+    intern->free_size  -= size;
+
+    return intern_string;
+}
+
+inline void
+Container_GrowIntern (struct container__intern* restrict intern)
+{
+    /*
+        Should the larger hash fail to allocate, the current one remains in use with longer
+        chains, and growing is tried again with the next string
+     */
+    if(intern->string_count > (size_t)intern->hash.bucket_count*CONTAINER__INTERN_MAX_LOAD)
+    {
+        Container_ResizeHash(
+                             intern->hash.bucket_count*2,
+                             &intern->hash,
+                             &Container_CachedHashValue,
+                             NULL
+                            );
+    }
+}
+
+
+inline enum container__error_code
+Container_CreateIntern (unsigned int count, struct container__intern* restrict intern)
+{
+    return Container_CreateInternWithAllocator(count, NULL, intern);
+}
+
+inline enum container__error_code
+Container_CreateInternWithAllocator (
+                                     unsigned int                       count,
+                                     const struct container__allocator* allocator,
+                                     struct container__intern* restrict intern
+                                    )
+{
+    enum container__error_code error;
+
+    if(count == 0)
+        count = 1;
+
+    error = Container_CreateHashWithAllocator(
+                                              count,
+                                              container__hash_alloc_default,
+                                              allocator,
+                                              &intern->hash
+                                             );
+    if(error != container__error_none)
+        return error;
+
+    intern->chunks       = NULL;
+    intern->free_space   = NULL;
+    intern->free_size    = 0;
+    intern->string_count = 0;
+    intern->string_size  = 0;
+    intern->chunk_count  = 0;
+    intern->allocator    = allocator;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyIntern (struct container__intern* restrict intern)
+{
+    struct container__intern_chunk* chunk;
+
+    chunk = intern->chunks;
+    while(chunk != NULL)
+    {
+        struct container__intern_chunk* next;
+
+        next = chunk->next;
+
+        Container_FreeMemory(chunk, chunk->size, intern->allocator);
+
+        chunk = next;
+    }
+
+    Container_DestroyHash(&intern->hash);
+}
+
+inline enum container__error_code
+Container_InternString (
+                        const char*                        string,
+                        size_t                             length,
+                        const char** restrict              handle,
+                        struct container__intern* restrict intern
+                       )
+{
+    struct container__string_key     key;
+    struct container__hash_bucket*   searched_bucket;
+    struct container__hash_node*     found_node;
+    struct container__intern_string* intern_string;
+
+    Container_InitStringKey(string, length, &key);
+
+    found_node = Container_LookupCachedHashNode(
+                                                key.value_hash,
+                                                &key,
+                                                &intern->hash,
+                                                &Container_InternLookup,
+                                                NULL,
+                                                &searched_bucket
+                                               );
+    if(found_node != NULL)
+    {
+        intern_string = CONTAINER__CONTAINER_OF(
+                                                found_node,
+                                                struct container__intern_string,
+                                                node.node
+                                               );
+
+        *handle = intern_string->string;
+
+        return container__error_none;
+    }
+
+    intern_string = Container_AllocInternString(length, intern);
+    if(intern_string == NULL)
+        return container__error_memory_alloc;
+
+    intern_string->length = length;
+
+    memcpy(intern_string->string, string, length);
+
+    intern_string->string[length] = '\0';
+
+    Container_InsCachedHashNode(key.value_hash, &intern_string->node, searched_bucket);
+
+    intern->string_count++;
+    intern->string_size += length;
+
+    *handle = intern_string->string;
+
+    Container_GrowIntern(intern);
+
+    return container__error_none;
+}
+
+inline const char*
+Container_FindInternString (
+                            const char*                        string,
+                            size_t                             length,
+                            struct container__intern* restrict intern
+                           )
+{
+    struct container__string_key     key;
+    struct container__hash_bucket*   searched_bucket;
+    struct container__hash_node*     found_node;
+    struct container__intern_string* intern_string;
+
+    Container_InitStringKey(string, length, &key);
+
+    found_node = Container_LookupCachedHashNode(
+                                                key.value_hash,
+                                                &key,
+                                                &intern->hash,
+                                                &Container_InternLookup,
+                                                NULL,
+                                                &searched_bucket
+                                               );
+    if(found_node == NULL)
+        return NULL;
+
+    intern_string = CONTAINER__CONTAINER_OF(
+                                            found_node,
+                                            struct container__intern_string,
+                                            node.node
+                                           );
+
+    return intern_string->string;
+}
+
+inline size_t
+Container_InternStringLength (const char* handle)
+{
+    return Container_InternStringOf(handle)->length;
+}
+
+inline unsigned int
+Container_InternStringHash (const char* handle)
+{
+    return Container_InternStringOf(handle)->node.value_hash;
+}
+
+
+#endif
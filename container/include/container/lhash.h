@@ -0,0 +1,604 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The lhash container manages a hash of elements which grows using linear hashing.  Rather
+    than rehashing every node at once, a single bucket is split as each node is added and
+    buckets are merged back as nodes are removed, so the bucket count tracks the node count
+    without any one operation stalling on a full rehash.
+
+    Buckets and nodes are the same as those used by the hash container, so the hash bucket
+    scan functions may be used to scan lhash buckets
+ */
+
+
+#ifndef _CONTAINER__LHASH_H_
+#define _CONTAINER__LHASH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/clist.h>
+#include <container/hash.h>
+
+
+/*
+    Buckets are allocated in segments of this many buckets.  Segments never move once
+    allocated, so bucket addresses remain stable as the lhash grows
+ */
+#define CONTAINER__LHASH_SEGMENT_SHIFT 8
+#define CONTAINER__LHASH_SEGMENT_SIZE  (1u << CONTAINER__LHASH_SEGMENT_SHIFT)
+
+
+/*
+    The lhash container itself
+
+    Accessible members:
+        node_count -- the number of nodes currently in the lhash
+        allocator  -- the allocator used for the directory and bucket segments
+ */
+struct container__lhash
+{
+    unsigned int node_count;
+    unsigned int load_factor;
+
+    unsigned int min_bucket_count;
+    unsigned int max_bucket;
+    unsigned int low_mask;
+    unsigned int high_mask;
+
+    unsigned int                    segment_count;
+    unsigned int                    directory_size;
+    struct container__hash_bucket** directory;
+
+    container__hash_value_type value;
+    void*                      user_data;
+
+    const struct container__allocator* allocator;
+};
+
+
+/*
+    Allocate the initial hash buckets and initialize an lhash.  The bucket count is rounded up
+    to a power of two and is the minimum number of buckets the lhash will shrink to.  Buckets
+    are split once the average number of nodes per bucket exceeds the load factor.  The value
+    function is used to recompute the hash value of nodes as their buckets are split.  The
+    container will be empty upon initialization
+
+    Syntax:
+        error = Container_CreateLHash(
+                                      bucket_count,
+                                      load_factor,
+                                      &MyHashValue,
+                                      my_user_data,
+                                      &my_lhash
+                                     );
+ */
+inline enum container__error_code
+Container_CreateLHash (
+                       unsigned int,
+                       unsigned int,
+                       container__hash_value_type,
+                       void*,
+                       struct container__lhash* restrict
+                      );
+
+/*
+    Allocate the initial hash buckets using an allocator and initialize an lhash as with
+    Container_CreateLHash.  The allocator is also used for the segments and directory
+    allocated as the lhash grows
+
+    Syntax:
+        error = Container_CreateLHashWithAllocator(
+                                                   bucket_count,
+                                                   load_factor,
+                                                   &MyHashValue,
+                                                   my_user_data,
+                                                   &my_allocator,
+                                                   &my_lhash
+                                                  );
+ */
+inline enum container__error_code
+Container_CreateLHashWithAllocator (
+                                    unsigned int,
+                                    unsigned int,
+                                    container__hash_value_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__lhash* restrict
+                                   );
+
+/*
+    Cleanup a previously created lhash
+
+    Syntax:
+        Container_DestroyLHash(&my_lhash);
+ */
+inline void
+Container_DestroyLHash (struct container__lhash* restrict);
+
+
+/*
+    Reset an lhash container to the initialized state.  Allocated buckets are retained for
+    reuse as the lhash grows again
+
+    Syntax:
+        Container_ResetLHash(&my_lhash);
+ */
+inline void
+Container_ResetLHash (struct container__lhash* restrict);
+
+
+/*
+    Return the number of buckets currently in use by the lhash
+
+    Syntax:
+        bucket_count = Container_LHashBucketCount(&my_lhash);
+ */
+inline unsigned int
+Container_LHashBucketCount (struct container__lhash* restrict);
+
+/*
+    Return the bucket at the specified index, which must be less than the current bucket count
+
+    Syntax:
+        bucket = Container_LHashBucket(bucket_index, &my_lhash);
+ */
+inline struct container__hash_bucket*
+Container_LHashBucket (unsigned int, struct container__lhash* restrict);
+
+
+/*
+   Lookup the bucket which maps to the specified hash value
+
+   Syntax:
+     found_bucket = Container_LookupLHashBucket(value, &my_lhash);
+ */
+inline struct container__hash_bucket*
+Container_LookupLHashBucket (unsigned int, struct container__lhash* restrict);
+
+/*
+    Lookup a node in the lhash.  Upon completion, the bucket searched for the node will be
+    set and the found node returned.  If no node was found, NULL is returned
+
+    Syntax:
+        found_node = Container_LookupLHashNode(
+                                               MyHashValue(lookup_id),
+                                               &lookup_id,
+                                               &my_lhash,
+                                               &MyLookup,
+                                               my_user_data,
+                                               &searched_bucket
+                                              );
+ */
+inline struct container__hash_node*
+Container_LookupLHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__lhash* restrict,
+                           container__hash_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+
+/*
+    Add a node to the lhash, specifying the hash value for the node.  At most one bucket is
+    split as a result.  Should allocating more buckets fail, the node is still added and
+    splitting is deferred until a later add
+
+    Syntax:
+        Container_AddLHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_lhash);
+ */
+inline void
+Container_AddLHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__lhash* restrict
+                       );
+
+/*
+    Insert a node into the specified lhash bucket.  The bucket must have been returned by a
+    lookup with no modifications to the lhash since
+
+    Syntax:
+        Container_InsLHashNode(&my_element.node, searched_bucket, &my_lhash);
+ */
+inline void
+Container_InsLHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__lhash* restrict
+                       );
+
+/*
+    Remove a node from the lhash.  At most two buckets are merged as a result
+
+    Syntax:
+        Container_RemoveLHashNode(&my_element.node, &my_lhash);
+ */
+inline void
+Container_RemoveLHashNode (
+                           struct container__hash_node* restrict,
+                           struct container__lhash* restrict
+                          );
+
+
+#include <container/utils.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <limits.h>
+
+
+inline unsigned int
+Container_LHashBucketIndex (unsigned int, struct container__lhash* restrict);
+
+inline enum container__error_code
+Container_AllocLHashSegment (unsigned int, struct container__lhash* restrict);
+
+inline void
+Container_SplitLHashBucket (struct container__lhash* restrict);
+
+inline void
+Container_MergeLHashBucket (struct container__lhash* restrict);
+
+
+inline unsigned int
+Container_LHashBucketIndex (unsigned int value_hash, struct container__lhash* restrict lhash)
+{
+    unsigned int index;
+
+    index = value_hash&lhash->high_mask;
+    if(index > lhash->max_bucket)
+        index &= lhash->low_mask;
+
+    return index;
+}
+
+inline enum container__error_code
+Container_AllocLHashSegment (unsigned int segment, struct container__lhash* restrict lhash)
+{
+    struct container__hash_bucket* buckets;
+
+    if(segment >= lhash->directory_size)
+    {
+        struct container__hash_bucket** directory;
+        unsigned int                    directory_size;
+
+        directory_size = lhash->directory_size*2;
+        directory      = Container_ReallocMemory(
+                                                 lhash->directory,
+                                                 sizeof(*directory)*lhash->directory_size,
+                                                 sizeof(*directory)*directory_size,
+                                                 lhash->allocator
+                                                );
+        if(directory == NULL)
+            return container__error_memory_alloc;
+
+        lhash->directory      = directory;
+        lhash->directory_size = directory_size;
+    }
+
+    buckets = Container_AllocMemory(
+                                    sizeof(struct container__hash_bucket)*CONTAINER__LHASH_SEGMENT_SIZE,
+                                    lhash->allocator
+                                   );
+    if(buckets == NULL)
+        return container__error_memory_alloc;
+
+    lhash->directory[segment] = buckets;
+    lhash->segment_count      = segment+1;
+
+    return container__error_none;
+}
+
+inline void
+Container_SplitLHashBucket (struct container__lhash* restrict lhash)
+{
+    struct container__hash_bucket* old_bucket;
+    struct container__hash_bucket* new_bucket;
+    struct container__clist_node*  sentinel;
+    struct container__clist_node*  list_node;
+    struct container__clist_node*  next_node;
+    unsigned int                   new_index;
+    unsigned int                   segment;
+
+    if(lhash->max_bucket == UINT_MAX)
+        return;
+
+    new_index = lhash->max_bucket+1;
+    segment   = new_index>>CONTAINER__LHASH_SEGMENT_SHIFT;
+    if(segment >= lhash->segment_count)
+    {
+        enum container__error_code error;
+
+        error = Container_AllocLHashSegment(segment, lhash);
+        if(error != container__error_none)
+            return;
+    }
+
+    old_bucket = Container_LHashBucket(new_index&lhash->low_mask, lhash);
+    new_bucket = Container_LHashBucket(new_index, lhash);
+
+    Container_InitCList(&new_bucket->node_list);
+
+    lhash->max_bucket = new_index;
+    if(new_index > lhash->high_mask)
+    {
+        lhash->low_mask  = lhash->high_mask;
+        lhash->high_mask = new_index|lhash->low_mask;
+    }
+
+    sentinel = &old_bucket->node_list.sentinel;
+    for(list_node = sentinel->next; list_node != sentinel; list_node = next_node)
+    {
+        struct container__hash_node* hash_node;
+        unsigned int                 value_hash;
+
+        next_node = list_node->next;
+        hash_node = CONTAINER__CONTAINER_OF(list_node, struct container__hash_node, node);
+
+        value_hash = (*lhash->value)(hash_node, lhash->user_data);
+        if((value_hash&lhash->high_mask) != new_index)
+            continue;
+
+        Container_RemoveCListNode(list_node);
+        Container_AddCListTail(list_node, &new_bucket->node_list);
+    }
+}
+
+inline void
+Container_MergeLHashBucket (struct container__lhash* restrict lhash)
+{
+    struct container__hash_bucket* old_bucket;
+    struct container__hash_bucket* into_bucket;
+    unsigned int                   old_index;
+
+    old_index   = lhash->max_bucket;
+    old_bucket  = Container_LHashBucket(old_index, lhash);
+    into_bucket = Container_LHashBucket(old_index&lhash->low_mask, lhash);
+
+    Container_MergeCListTail(&old_bucket->node_list, &into_bucket->node_list);
+
+    lhash->max_bucket = old_index-1;
+    if(lhash->max_bucket == lhash->low_mask)
+    {
+        lhash->high_mask   = lhash->low_mask;
+        lhash->low_mask  >>= 1;
+    }
+}
+
+
+inline enum container__error_code
+Container_CreateLHash (
+                       unsigned int                      count,
+                       unsigned int                      load_factor,
+                       container__hash_value_type        value,
+                       void*                             user_data,
+                       struct container__lhash* restrict lhash
+                      )
+{
+    return Container_CreateLHashWithAllocator(count, load_factor, value, user_data, NULL, lhash);
+}
+
+inline enum container__error_code
+Container_CreateLHashWithAllocator (
+                                    unsigned int                       count,
+                                    unsigned int                       load_factor,
+                                    container__hash_value_type         value,
+                                    void*                              user_data,
+                                    const struct container__allocator* allocator,
+                                    struct container__lhash* restrict  lhash
+                                   )
+{
+    unsigned int bucket_count;
+    unsigned int segment_count;
+
+    bucket_count = 1;
+    while(bucket_count < count && bucket_count <= UINT_MAX/4)
+        bucket_count <<= 1;
+
+    segment_count = (bucket_count+CONTAINER__LHASH_SEGMENT_SIZE-1)>>CONTAINER__LHASH_SEGMENT_SHIFT;
+
+    lhash->allocator = allocator;
+    lhash->directory = Container_AllocMemory(sizeof(*lhash->directory)*segment_count, allocator);
+    if(lhash->directory == NULL)
+        return container__error_memory_alloc;
+
+    lhash->directory_size = segment_count;
+    lhash->segment_count  = 0;
+
+    for(unsigned int segment = 0; segment < segment_count; segment++)
+    {
+        enum container__error_code error;
+
+        error = Container_AllocLHashSegment(segment, lhash);
+        if(error != container__error_none)
+        {
+            Container_DestroyLHash(lhash);
+
+            return error;
+        }
+    }
+
+    lhash->load_factor      = load_factor > 0 ? load_factor : 1;
+    lhash->min_bucket_count = bucket_count;
+    lhash->value            = value;
+    lhash->user_data        = user_data;
+
+    Container_ResetLHash(lhash);
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyLHash (struct container__lhash* restrict lhash)
+{
+    unsigned int segment;
+
+    segment = lhash->segment_count;
+    while(segment-- > 0)
+    {
+        Container_FreeMemory(
+                             lhash->directory[segment],
+                             sizeof(struct container__hash_bucket)*CONTAINER__LHASH_SEGMENT_SIZE,
+                             lhash->allocator
+                            );
+    }
+
+    Container_FreeMemory(
+                         lhash->directory,
+                         sizeof(*lhash->directory)*lhash->directory_size,
+                         lhash->allocator
+                        );
+}
+
+inline void
+Container_ResetLHash (struct container__lhash* restrict lhash)
+{
+    unsigned int count;
+
+    count = lhash->min_bucket_count;
+
+    lhash->node_count = 0;
+    lhash->max_bucket = count-1;
+    lhash->low_mask   = count-1;
+    lhash->high_mask  = (count<<1)-1;
+
+    while(count-- > 0)
+        Container_InitCList(&Container_LHashBucket(count, lhash)->node_list);
+}
+
+inline unsigned int
+Container_LHashBucketCount (struct container__lhash* restrict lhash)
+{
+    return lhash->max_bucket+1;
+}
+
+inline struct container__hash_bucket*
+Container_LHashBucket (unsigned int index, struct container__lhash* restrict lhash)
+{
+    struct container__hash_bucket* segment;
+
+    segment = lhash->directory[index>>CONTAINER__LHASH_SEGMENT_SHIFT];
+
+    return &segment[index&(CONTAINER__LHASH_SEGMENT_SIZE-1)];
+}
+
+inline struct container__hash_bucket*
+Container_LookupLHashBucket (unsigned int value_hash, struct container__lhash* restrict lhash)
+{
+    struct container__hash_bucket* hash_bucket;
+    unsigned int                   index;
+
+    index       = Container_LHashBucketIndex(value_hash, lhash);
+    hash_bucket = Container_LHashBucket(index, lhash);
+
+    return hash_bucket;
+}
+
+inline struct container__hash_node*
+Container_LookupLHashNode (
+                           unsigned int                             value_hash,
+                           void*                                    value,
+                           struct container__lhash* restrict        lhash,
+                           container__hash_lookup_type              lookup,
+                           void*                                    user_data,
+                           struct container__hash_bucket** restrict searched_bucket
+                          )
+{
+    struct container__hash_bucket_scan scan;
+    struct container__hash_bucket*     hash_bucket;
+
+    hash_bucket      = Container_LookupLHashBucket(value_hash, lhash);
+    *searched_bucket = hash_bucket;
+
+    for(
+        Container_StartHashBucketScan(hash_bucket, &scan);
+        Container_HashBucketScanState(&scan) != container__hash_bucket_scan_finished;
+        Container_ResumeHashBucketScan(hash_bucket, &scan)
+       )
+    {
+        enum container__hash_cmp_result result;
+
+        result = (*lookup)(value, scan.current_node, user_data);
+        if(result == container__hash_node_equal)
+            return scan.current_node;
+    }
+
+    return NULL;
+}
+
+inline void
+Container_AddLHashNode (
+                        unsigned int                          value_hash,
+                        struct container__hash_node* restrict node,
+                        struct container__lhash* restrict     lhash
+                       )
+{
+    struct container__hash_bucket* hash_bucket;
+
+    hash_bucket = Container_LookupLHashBucket(value_hash, lhash);
+
+    Container_InsLHashNode(node, hash_bucket, lhash);
+}
+
+inline void
+Container_InsLHashNode (
+                        struct container__hash_node* restrict   node,
+                        struct container__hash_bucket* restrict bucket,
+                        struct container__lhash* restrict       lhash
+                       )
+{
+    Container_AddCListHead(&node->node, &bucket->node_list);
+
+    lhash->node_count++;
+
+    if(lhash->node_count/lhash->load_factor > lhash->max_bucket)
+        Container_SplitLHashBucket(lhash);
+}
+
+inline void
+Container_RemoveLHashNode (
+                           struct container__hash_node* restrict node,
+                           struct container__lhash* restrict     lhash
+                          )
+{
+    Container_RemoveCListNode(&node->node);
+
+    lhash->node_count--;
+
+    /* Merging two buckets per removal lets the bucket count keep pace with the node count */
+    for(unsigned int merge_count = 0; merge_count < 2; merge_count++)
+    {
+        if(lhash->max_bucket < lhash->min_bucket_count)
+            break;
+
+        if(lhash->node_count/lhash->load_factor >= lhash->max_bucket/2)
+            break;
+
+        Container_MergeLHashBucket(lhash);
+    }
+}
+
+
+#endif
@@ -0,0 +1,205 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The rhash functions operate on a hash shared between a single writer and any number of
+    readers which take no locks.  Readers follow bucket chains with acquire loads, and the
+    writer publishes added and removed nodes with release stores.  A removed node is left
+    intact so readers already visiting it may continue along the chain, and it must not be
+    reused until no reader can still reach it.  Readers should therefore look up nodes within
+    an epoch critical section, and the writer should retire removed nodes with the epoch
+    container rather than reusing them directly.
+
+    Only the rhash functions may be used on a hash while readers are active.  The writer may
+    be any one thread at a time, with writers otherwise serialized by the caller
+ */
+
+
+#ifndef _CONTAINER__RHASH_H_
+#define _CONTAINER__RHASH_H_
+
+
+#include <container/hash.h>
+
+
+/*
+    Lookup a node in a hash without taking any locks.  The found node is returned, or NULL if
+    no node was found.  The node remains valid for as long as the reader remains within the
+    epoch critical section the lookup was made in
+
+    Syntax:
+        Container_EnterEpoch(my_reader_index, &my_epoch);
+
+        found_node = Container_LookupRHashNode(
+                                               MyHashValue(lookup_id),
+                                               &lookup_id,
+                                               &my_hash,
+                                               &MyLookup,
+                                               my_user_data
+                                              );
+
+        ...
+
+        Container_ExitEpoch(my_reader_index, &my_epoch);
+ */
+inline struct container__hash_node*
+Container_LookupRHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__hash* restrict,
+                           container__hash_lookup_type,
+                           void*
+                          );
+
+
+/*
+     Add a node to the hash, publishing it to readers.  The element must be fully initialized
+     before it is added, and the lookup fields of the element must not change while it is in
+     the hash
+
+     Syntax:
+         Container_AddRHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_hash);
+ */
+inline void
+Container_AddRHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__hash* restrict
+                       );
+
+/*
+    Insert a node into the specified hash bucket, publishing it to readers
+
+    Syntax:
+        Container_InsRHashNode(&my_element.node, &my_hash_bucket);
+ */
+inline void
+Container_InsRHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict
+                       );
+
+/*
+    Remove a node from the hash.  Readers which have already reached the node may still visit
+    it, so it should be retired rather than reused
+
+    Syntax:
+        Container_RemoveRHashNode(&my_element.node);
+
+        Container_RetireEpochNode(&my_element.epoch_node, &my_epoch);
+ */
+inline void
+Container_RemoveRHashNode (struct container__hash_node* restrict);
+
+
+#include <container/utils.h>
+
+#include <stddef.h>
+
+
+inline struct container__hash_node*
+Container_LookupRHashNode (
+                           unsigned int                     value_hash,
+                           void*                            value,
+                           struct container__hash* restrict hash,
+                           container__hash_lookup_type      lookup,
+                           void*                            user_data
+                          )
+{
+    struct container__hash_bucket* hash_bucket;
+    struct container__clist_node*  sentinel;
+    struct container__clist_node*  list_node;
+
+    /*
+        The bucket is found without Container_LookupHashBucket, so that readers never write to
+        the hash, even to mark an occupancy bitmap
+     */
+    hash_bucket = &hash->buckets[Container_HashBucketIndex(value_hash, hash)];
+    sentinel    = &hash_bucket->node_list.sentinel;
+
+    for(
+        list_node = __atomic_load_n(&sentinel->next, __ATOMIC_ACQUIRE);
+        list_node != sentinel;
+        list_node = __atomic_load_n(&list_node->next, __ATOMIC_ACQUIRE)
+       )
+    {
+        struct container__hash_node*    hash_node;
+        enum container__hash_cmp_result result;
+
+        hash_node = CONTAINER__CONTAINER_OF(list_node, struct container__hash_node, node);
+
+        result = (*lookup)(value, hash_node, user_data);
+        if(result == container__hash_node_equal)
+            return hash_node;
+    }
+
+    return NULL;
+}
+
+inline void
+Container_AddRHashNode (
+                        unsigned int                          value_hash,
+                        struct container__hash_node* restrict node,
+                        struct container__hash* restrict      hash
+                       )
+{
+    struct container__hash_bucket* hash_bucket;
+
+    hash_bucket = Container_LookupHashBucket(value_hash, hash);
+
+    Container_InsRHashNode(node, hash_bucket);
+}
+
+inline void
+Container_InsRHashNode (
+                        struct container__hash_node* restrict   node,
+                        struct container__hash_bucket* restrict bucket
+                       )
+{
+    struct container__clist_node* sentinel;
+    struct container__clist_node* next;
+
+    sentinel = &bucket->node_list.sentinel;
+    next     = sentinel->next;
+
+    node->node.prev = sentinel;
+    node->node.next = next;
+    next->prev      = &node->node;
+
+    __atomic_store_n(&sentinel->next, &node->node, __ATOMIC_RELEASE);
+}
+
+inline void
+Container_RemoveRHashNode (struct container__hash_node* restrict node)
+{
+    struct container__clist_node* next;
+    struct container__clist_node* prev;
+
+    next = node->node.next;
+    prev = node->node.prev;
+
+    __atomic_store_n(&prev->next, next, __ATOMIC_RELEASE);
+
+    next->prev = prev;
+}
+
+
+#endif
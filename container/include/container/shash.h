@@ -0,0 +1,598 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The shash container manages a hash of elements which may be shared between threads.  The
+    buckets are guarded by an array of user-supplied sync objects, or stripes, with each bucket
+    guarded by the stripe its bucket index maps to.  Operations on buckets guarded by different
+    stripes proceed in parallel, and only one stripe is ever held at a time.  Lookups mark
+    their bucket in an occupancy bitmap before taking its stripe, so the hash of an shash
+    mustn't have one
+ */
+
+
+#ifndef _CONTAINER__SHASH_H_
+#define _CONTAINER__SHASH_H_
+
+
+#include <stddef.h>
+#include <container/error.h>
+#include <container/sync.h>
+#include <container/hash.h>
+
+
+/*
+    The shash container itself.  The stripes are an array of stripe_count sync objects, each
+    stripe_size bytes apart, passed to the lock and unlock functions.  Padding each stripe to
+    a cache line keeps threads holding neighbouring stripes from contending on the same line
+
+    Accessible members:
+        hash -- the underlying hash, which may be used with the hash functions while the
+                stripe for each bucket involved is held
+ */
+struct container__shash
+{
+    struct container__hash      hash;
+    unsigned int                stripe_count;
+    size_t                      stripe_size;
+    void*                       stripes;
+    container__lock_sync_type   lock_sync;
+    container__unlock_sync_type unlock_sync;
+};
+
+
+/*
+     Initialize a shash.  The container will be empty upon initialization and the stripes must
+     already be usable with the lock and unlock functions
+
+     Syntax:
+         Container_InitSHash(
+                             bucket_count,
+                             my_buckets_array,
+                             stripe_count,
+                             sizeof(my_stripes_array[0]),
+                             my_stripes_array,
+                             &MyLock,
+                             &MyUnlock,
+                             &my_shash
+                            );
+ */
+inline void
+Container_InitSHash (
+                     unsigned int,
+                     struct container__hash_bucket* restrict,
+                     unsigned int,
+                     size_t,
+                     void*,
+                     container__lock_sync_type,
+                     container__unlock_sync_type,
+                     struct container__shash* restrict
+                    );
+
+/*
+     Allocate shash buckets and initialize a shash.  The stripes remain owned by the caller
+
+     Syntax:
+         error = Container_CreateSHash(
+                                       bucket_count,
+                                       stripe_count,
+                                       sizeof(my_stripes_array[0]),
+                                       my_stripes_array,
+                                       &MyLock,
+                                       &MyUnlock,
+                                       &my_shash
+                                      );
+ */
+inline enum container__error_code
+Container_CreateSHash (
+                       unsigned int,
+                       unsigned int,
+                       size_t,
+                       void*,
+                       container__lock_sync_type,
+                       container__unlock_sync_type,
+                       struct container__shash* restrict
+                      );
+
+/*
+     Allocate a power of two number of shash buckets, specified as the base 2 logarithm of the
+     bucket count, and initialize a shash as with Container_InitHashShift
+
+     Syntax:
+         error = Container_CreateSHashShift(
+                                            bucket_shift,
+                                            stripe_count,
+                                            sizeof(my_stripes_array[0]),
+                                            my_stripes_array,
+                                            &MyLock,
+                                            &MyUnlock,
+                                            &my_shash
+                                           );
+ */
+inline enum container__error_code
+Container_CreateSHashShift (
+                            unsigned int,
+                            unsigned int,
+                            size_t,
+                            void*,
+                            container__lock_sync_type,
+                            container__unlock_sync_type,
+                            struct container__shash* restrict
+                           );
+
+/*
+     Allocate shash buckets using an allocator and initialize a shash.  The allocator is used
+     as it is by Container_CreateHashWithAllocator, and the stripes remain owned by the caller
+
+     Syntax:
+         error = Container_CreateSHashWithAllocator(
+                                                    bucket_count,
+                                                    stripe_count,
+                                                    sizeof(my_stripes_array[0]),
+                                                    my_stripes_array,
+                                                    &MyLock,
+                                                    &MyUnlock,
+                                                    &my_allocator,
+                                                    &my_shash
+                                                   );
+ */
+inline enum container__error_code
+Container_CreateSHashWithAllocator (
+                                    unsigned int,
+                                    unsigned int,
+                                    size_t,
+                                    void*,
+                                    container__lock_sync_type,
+                                    container__unlock_sync_type,
+                                    const struct container__allocator*,
+                                    struct container__shash* restrict
+                                   );
+
+/*
+     Allocate a power of two number of shash buckets using an allocator, and initialize a
+     shash as with Container_CreateSHashShift
+
+     Syntax:
+         error = Container_CreateSHashShiftWithAllocator(
+                                                         bucket_shift,
+                                                         stripe_count,
+                                                         sizeof(my_stripes_array[0]),
+                                                         my_stripes_array,
+                                                         &MyLock,
+                                                         &MyUnlock,
+                                                         &my_allocator,
+                                                         &my_shash
+                                                        );
+ */
+inline enum container__error_code
+Container_CreateSHashShiftWithAllocator (
+                                         unsigned int,
+                                         unsigned int,
+                                         size_t,
+                                         void*,
+                                         container__lock_sync_type,
+                                         container__unlock_sync_type,
+                                         const struct container__allocator*,
+                                         struct container__shash* restrict
+                                        );
+
+/*
+     Cleanup a previously created shash.  No other thread may be using the shash
+
+     Syntax:
+         Container_DestroySHash(&my_shash);
+ */
+inline void
+Container_DestroySHash (struct container__shash* restrict);
+
+
+/*
+    Return the stripe which guards the specified bucket
+
+    Syntax:
+        bucket_stripe = Container_SHashStripe(bucket, &my_shash);
+ */
+inline void*
+Container_SHashStripe (
+                       struct container__hash_bucket* restrict,
+                       struct container__shash* restrict
+                      );
+
+/*
+    Lock the stripe which guards the specified bucket
+
+    Syntax:
+        Container_LockSHashBucket(bucket, &my_shash);
+ */
+inline void
+Container_LockSHashBucket (
+                           struct container__hash_bucket* restrict,
+                           struct container__shash* restrict
+                          );
+
+/*
+    Unlock the stripe which guards the specified bucket
+
+    Syntax:
+        Container_UnlockSHashBucket(bucket, &my_shash);
+ */
+inline void
+Container_UnlockSHashBucket (
+                             struct container__hash_bucket* restrict,
+                             struct container__shash* restrict
+                            );
+
+
+/*
+   Lookup the bucket which maps to the specified hash value.  No stripe is locked
+
+   Syntax:
+     found_bucket = Container_LookupSHashBucket(value, &my_shash);
+ */
+inline struct container__hash_bucket*
+Container_LookupSHashBucket (unsigned int, struct container__shash* restrict);
+
+/*
+    Lookup a node in the shash.  Upon completion, the bucket searched for the node will be set
+    and the found node returned, or NULL if no node was found.  The stripe guarding the searched
+    bucket is left locked whether or not a node was found, so the found node may be used or a
+    new node inserted into the searched bucket with Container_InsSHashNode before the caller
+    unlocks the bucket with Container_UnlockSHashBucket
+
+    Syntax:
+        found_node = Container_LookupSHashNode(
+                                               MyHashValue(lookup_id),
+                                               &lookup_id,
+                                               &my_shash,
+                                               &MyLookup,
+                                               my_user_data,
+                                               &searched_bucket
+                                              );
+
+        ...
+
+        Container_UnlockSHashBucket(searched_bucket, &my_shash);
+ */
+inline struct container__hash_node*
+Container_LookupSHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__shash* restrict,
+                           container__hash_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+
+/*
+     Add a node to the shash, specifying the hash value for the node.  The stripe guarding the
+     node's bucket is locked for the duration of the add
+
+     Syntax:
+         Container_AddSHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_shash);
+ */
+inline void
+Container_AddSHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__shash* restrict
+                       );
+
+/*
+    Insert a node into the specified shash bucket.  The caller must hold the stripe guarding
+    the bucket, as left locked by Container_LookupSHashNode
+
+    Syntax:
+        Container_InsSHashNode(&my_element.node, searched_bucket);
+ */
+inline void
+Container_InsSHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict
+                       );
+
+/*
+    Remove a node from the shash, specifying the hash value the node was added with.  The
+    stripe guarding the node's bucket is locked for the duration of the remove.  A node found
+    with Container_LookupSHashNode may instead be removed with Container_RemoveHashNode before
+    the bucket is unlocked
+
+    Syntax:
+        Container_RemoveSHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_shash);
+ */
+inline void
+Container_RemoveSHashNode (
+                           unsigned int,
+                           struct container__hash_node* restrict,
+                           struct container__shash* restrict
+                          );
+
+
+#include <container/utils.h>
+
+
+inline void
+Container_InitSHashStripes (
+                            unsigned int,
+                            size_t,
+                            void*,
+                            container__lock_sync_type,
+                            container__unlock_sync_type,
+                            struct container__shash* restrict
+                           );
+
+
+inline void
+Container_InitSHashStripes (
+                            unsigned int                      stripe_count,
+                            size_t                            stripe_size,
+                            void*                             stripes,
+                            container__lock_sync_type         lock_sync,
+                            container__unlock_sync_type       unlock_sync,
+                            struct container__shash* restrict shash
+                           )
+{
+    shash->stripe_count = stripe_count;
+    shash->stripe_size  = stripe_size;
+    shash->stripes      = stripes;
+    shash->lock_sync    = lock_sync;
+    shash->unlock_sync  = unlock_sync;
+}
+
+
+inline void
+Container_InitSHash (
+                     unsigned int                            count,
+                     struct container__hash_bucket* restrict buckets,
+                     unsigned int                            stripe_count,
+                     size_t                                  stripe_size,
+                     void*                                   stripes,
+                     container__lock_sync_type               lock_sync,
+                     container__unlock_sync_type             unlock_sync,
+                     struct container__shash* restrict       shash
+                    )
+{
+    Container_InitHash(count, buckets, &shash->hash);
+    Container_InitSHashStripes(stripe_count, stripe_size, stripes, lock_sync, unlock_sync, shash);
+}
+
+inline enum container__error_code
+Container_CreateSHash (
+                       unsigned int                      count,
+                       unsigned int                      stripe_count,
+                       size_t                            stripe_size,
+                       void*                             stripes,
+                       container__lock_sync_type         lock_sync,
+                       container__unlock_sync_type       unlock_sync,
+                       struct container__shash* restrict shash
+                      )
+{
+    enum container__error_code error;
+
+    error = Container_CreateHash(count, &shash->hash);
+    if(error != container__error_none)
+        return error;
+
+    Container_InitSHashStripes(stripe_count, stripe_size, stripes, lock_sync, unlock_sync, shash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_CreateSHashShift (
+                            unsigned int                      shift,
+                            unsigned int                      stripe_count,
+                            size_t                            stripe_size,
+                            void*                             stripes,
+                            container__lock_sync_type         lock_sync,
+                            container__unlock_sync_type       unlock_sync,
+                            struct container__shash* restrict shash
+                           )
+{
+    enum container__error_code error;
+
+    error = Container_CreateHashShift(shift, &shash->hash);
+    if(error != container__error_none)
+        return error;
+
+    Container_InitSHashStripes(stripe_count, stripe_size, stripes, lock_sync, unlock_sync, shash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_CreateSHashWithAllocator (
+                                    unsigned int                       count,
+                                    unsigned int                       stripe_count,
+                                    size_t                             stripe_size,
+                                    void*                              stripes,
+                                    container__lock_sync_type          lock_sync,
+                                    container__unlock_sync_type        unlock_sync,
+                                    const struct container__allocator* allocator,
+                                    struct container__shash* restrict  shash
+                                   )
+{
+    enum container__error_code error;
+
+    error = Container_CreateHashWithAllocator(
+                                              count,
+                                              container__hash_alloc_default,
+                                              allocator,
+                                              &shash->hash
+                                             );
+    if(error != container__error_none)
+        return error;
+
+    Container_InitSHashStripes(stripe_count, stripe_size, stripes, lock_sync, unlock_sync, shash);
+
+    return container__error_none;
+}
+
+inline enum container__error_code
+Container_CreateSHashShiftWithAllocator (
+                                         unsigned int                       shift,
+                                         unsigned int                       stripe_count,
+                                         size_t                             stripe_size,
+                                         void*                              stripes,
+                                         container__lock_sync_type          lock_sync,
+                                         container__unlock_sync_type        unlock_sync,
+                                         const struct container__allocator* allocator,
+                                         struct container__shash* restrict  shash
+                                        )
+{
+    enum container__error_code error;
+
+    error = Container_CreateHashShiftWithAllocator(
+                                                   shift,
+                                                   container__hash_alloc_default,
+                                                   allocator,
+                                                   &shash->hash
+                                                  );
+    if(error != container__error_none)
+        return error;
+
+    Container_InitSHashStripes(stripe_count, stripe_size, stripes, lock_sync, unlock_sync, shash);
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroySHash (struct container__shash* restrict shash)
+{
+    Container_DestroyHash(&shash->hash);
+}
+
+inline void*
+Container_SHashStripe (
+                       struct container__hash_bucket* restrict bucket,
+                       struct container__shash* restrict       shash
+                      )
+{
+    unsigned int bucket_index;
+    unsigned int stripe_index;
+
+    bucket_index = (unsigned int)(bucket-shash->hash.buckets);
+    stripe_index = bucket_index%shash->stripe_count;
+
+    return (char*)shash->stripes+stripe_index*shash->stripe_size;
+}
+
+inline void
+Container_LockSHashBucket (
+                           struct container__hash_bucket* restrict bucket,
+                           struct container__shash* restrict       shash
+                          )
+{
+    Container_LockSync(Container_SHashStripe(bucket, shash), shash->lock_sync);
+}
+
+inline void
+Container_UnlockSHashBucket (
+                             struct container__hash_bucket* restrict bucket,
+                             struct container__shash* restrict       shash
+                            )
+{
+    Container_UnlockSync(Container_SHashStripe(bucket, shash), shash->unlock_sync);
+}
+
+inline struct container__hash_bucket*
+Container_LookupSHashBucket (unsigned int value_hash, struct container__shash* restrict shash)
+{
+    return Container_LookupHashBucket(value_hash, &shash->hash);
+}
+
+inline struct container__hash_node*
+Container_LookupSHashNode (
+                           unsigned int                             value_hash,
+                           void*                                    value,
+                           struct container__shash* restrict        shash,
+                           container__hash_lookup_type              lookup,
+                           void*                                    user_data,
+                           struct container__hash_bucket** restrict searched_bucket
+                          )
+{
+    struct container__hash_bucket_scan scan;
+    struct container__hash_bucket*     hash_bucket;
+
+    hash_bucket      = Container_LookupHashBucket(value_hash, &shash->hash);
+    *searched_bucket = hash_bucket;
+
+    Container_LockSHashBucket(hash_bucket, shash);
+
+    for(
+        Container_StartHashBucketScan(hash_bucket, &scan);
+        Container_HashBucketScanState(&scan) != container__hash_bucket_scan_finished;
+        Container_ResumeHashBucketScan(hash_bucket, &scan)
+       )
+    {
+        enum container__hash_cmp_result result;
+
+        result = (*lookup)(value, scan.current_node, user_data);
+        if(result == container__hash_node_equal)
+            return scan.current_node;
+    }
+
+    return NULL;
+}
+
+inline void
+Container_AddSHashNode (
+                        unsigned int                          value_hash,
+                        struct container__hash_node* restrict node,
+                        struct container__shash* restrict     shash
+                       )
+{
+    struct container__hash_bucket* hash_bucket;
+
+    hash_bucket = Container_LookupHashBucket(value_hash, &shash->hash);
+
+    Container_LockSHashBucket(hash_bucket, shash);
+    Container_InsHashNode(node, hash_bucket);
+    Container_UnlockSHashBucket(hash_bucket, shash);
+}
+
+inline void
+Container_InsSHashNode (
+                        struct container__hash_node* restrict   node,
+                        struct container__hash_bucket* restrict bucket
+                       )
+{
+    Container_InsHashNode(node, bucket);
+}
+
+inline void
+Container_RemoveSHashNode (
+                           unsigned int                          value_hash,
+                           struct container__hash_node* restrict node,
+                           struct container__shash* restrict     shash
+                          )
+{
+    struct container__hash_bucket* hash_bucket;
+
+    hash_bucket = Container_LookupHashBucket(value_hash, &shash->hash);
+
+    Container_LockSHashBucket(hash_bucket, shash);
+    Container_RemoveHashNode(node);
+    Container_UnlockSHashBucket(hash_bucket, shash);
+}
+
+
+#endif
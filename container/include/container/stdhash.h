@@ -20,7 +20,12 @@
  */
 
 /*
-    Standard types for use with the hash container
+    Standard types for use with the hash container.  The HashKey functions compute the hash
+    value of each key with the hashfn functions, so callers need not supply their own.  They
+    are generated with CONTAINER__DEFINE_EXTERN_HASH, so each key comparison is made inline
+    rather than through a lookup function, and are exported from the library as the other
+    functions are.  The blob nodes hold binary keys, compared with the vectorized equality
+    functions in blob.h
  */
 
 
@@ -28,7 +33,24 @@
 #define _CONTAINER__STDHASH_H_
 
 
+#include <container/blob.h>
 #include <container/hash.h>
+#include <container/hashfn.h>
+#include <container/hashgen.h>
+
+#include <stddef.h>
+
+
+/*
+    The number of leading bytes of a string key kept in its prefix
+ */
+#define CONTAINER__STRING_KEY_PREFIX_SIZE 8
+
+/*
+    The size of the buffer within an inline string node.  Strings shorter than this are
+    stored in the node along with their terminating null
+ */
+#define CONTAINER__INLINE_STRING_SIZE 16
 
 
 struct container__int_hash_node
@@ -61,6 +83,67 @@ struct container__string_hash_node
     struct container__hash_node node;
 };
 
+/*
+    A string along with its length, hash value and leading bytes, initialized with
+    Container_InitStringKey.  Keys of different lengths, hash values or prefixes are
+    rejected without reading the strings themselves
+
+    Accessible members:
+        string     -- the string, which need not be null terminated
+        length     -- the length of the string
+        value_hash -- the hash value of the string, as computed by Container_HashBytes
+ */
+struct container__string_key
+{
+    const char*        string;
+    size_t             length;
+    unsigned int       value_hash;
+    unsigned long long prefix;
+};
+
+struct container__string_key_hash_node
+{
+    struct container__string_key value;
+    struct container__hash_node  node;
+};
+
+/*
+    A node which stores short strings within itself, so that comparing them never leaves the
+    node, and refers to longer strings as the string node does.  The string is returned by
+    Container_InlineStringHashValue
+ */
+struct container__inline_string_hash_node
+{
+    unsigned int value_hash;
+    unsigned int length;
+
+    union
+    {
+        const char* external;
+        char        internal[CONTAINER__INLINE_STRING_SIZE];
+    } value;
+
+    struct container__hash_node node;
+};
+
+struct container__blob16_hash_node
+{
+    struct container__blob16    value;
+    struct container__hash_node node;
+};
+
+struct container__blob32_hash_node
+{
+    struct container__blob32    value;
+    struct container__hash_node node;
+};
+
+struct container__blob_hash_node
+{
+    struct container__blob      value;
+    struct container__hash_node node;
+};
+
 
 inline enum container__hash_cmp_result
 Container_IntHashTest (int, int);
@@ -165,6 +248,9 @@ Container_InsULongHash (
 inline enum container__hash_cmp_result
 Container_StringHashTest (char*, char*);
 
+inline unsigned int
+Container_StringHashKeyValue (char*);
+
 inline enum container__hash_cmp_result
 Container_StringHashLookup (
                             void*,
@@ -187,6 +273,162 @@ Container_InsStringHash (
                          struct container__hash_bucket* restrict
                         );
 
+/*
+    Initialize a string key with a string of the specified length, computing its hash value
+
+    Syntax:
+        Container_InitStringKey(my_string, strlen(my_string), &my_key);
+ */
+inline void
+Container_InitStringKey (const char*, size_t, struct container__string_key* restrict);
+
+inline enum container__hash_cmp_result
+Container_StringKeyHashTest (struct container__string_key, struct container__string_key);
+
+inline unsigned int
+Container_StringKeyHashKeyValue (struct container__string_key);
+
+inline enum container__hash_cmp_result
+Container_StringKeyHashLookup (
+                               void*,
+                               struct container__hash_node* restrict,
+                               void*
+                              );
+
+inline void
+Container_AddStringKeyHash (
+                            struct container__string_key,
+                            struct container__string_key_hash_node* restrict,
+                            struct container__hash* restrict
+                           );
+
+inline void
+Container_InsStringKeyHash (
+                            struct container__string_key,
+                            struct container__string_key_hash_node* restrict,
+                            struct container__hash_bucket* restrict
+                           );
+
+/*
+    Return the string held by an inline string node
+
+    Syntax:
+        string = Container_InlineStringHashValue(&my_element.node);
+ */
+inline const char*
+Container_InlineStringHashValue (struct container__inline_string_hash_node* restrict);
+
+inline enum container__hash_cmp_result
+Container_InlineStringHashTest (
+                                const struct container__string_key* restrict,
+                                struct container__inline_string_hash_node* restrict
+                               );
+
+inline enum container__hash_cmp_result
+Container_InlineStringHashLookup (
+                                  void*,
+                                  struct container__hash_node* restrict,
+                                  void*
+                                 );
+
+/*
+    Add an inline string node to a hash, copying the key's string into the node if it is
+    short enough.  Longer strings are referred to, and must outlive the node
+
+    Syntax:
+        Container_AddInlineStringHash(&my_key, &my_element.node, &my_hash);
+ */
+inline void
+Container_AddInlineStringHash (
+                               const struct container__string_key* restrict,
+                               struct container__inline_string_hash_node* restrict,
+                               struct container__hash* restrict
+                              );
+
+inline void
+Container_InsInlineStringHash (
+                               const struct container__string_key* restrict,
+                               struct container__inline_string_hash_node* restrict,
+                               struct container__hash_bucket* restrict
+                              );
+
+inline enum container__hash_cmp_result
+Container_Blob16HashTest (struct container__blob16, struct container__blob16);
+
+inline enum container__hash_cmp_result
+Container_Blob16HashLookup (
+                            void*,
+                            struct container__hash_node* restrict,
+                            void*
+                           );
+
+inline void
+Container_AddBlob16Hash (
+                         struct container__blob16,
+                         unsigned int,
+                         struct container__blob16_hash_node* restrict,
+                         struct container__hash* restrict
+                        );
+
+inline void
+Container_InsBlob16Hash (
+                         struct container__blob16,
+                         struct container__blob16_hash_node* restrict,
+                         struct container__hash_bucket* restrict
+                        );
+
+inline enum container__hash_cmp_result
+Container_Blob32HashTest (struct container__blob32, struct container__blob32);
+
+inline enum container__hash_cmp_result
+Container_Blob32HashLookup (
+                            void*,
+                            struct container__hash_node* restrict,
+                            void*
+                           );
+
+inline void
+Container_AddBlob32Hash (
+                         struct container__blob32,
+                         unsigned int,
+                         struct container__blob32_hash_node* restrict,
+                         struct container__hash* restrict
+                        );
+
+inline void
+Container_InsBlob32Hash (
+                         struct container__blob32,
+                         struct container__blob32_hash_node* restrict,
+                         struct container__hash_bucket* restrict
+                        );
+
+inline enum container__hash_cmp_result
+Container_BlobHashTest (struct container__blob, struct container__blob);
+
+inline unsigned int
+Container_BlobHashKeyValue (struct container__blob);
+
+inline enum container__hash_cmp_result
+Container_BlobHashLookup (
+                          void*,
+                          struct container__hash_node* restrict,
+                          void*
+                         );
+
+inline void
+Container_AddBlobHash (
+                       struct container__blob,
+                       struct container__blob_hash_node* restrict,
+                       struct container__hash* restrict
+                      );
+
+inline void
+Container_InsBlobHash (
+                       struct container__blob,
+                       struct container__blob_hash_node* restrict,
+                       struct container__hash_bucket* restrict
+                      );
+
 
 #include <string.h>
 #include <container/utils.h>
@@ -498,5 +740,485 @@ Container_InsStringHash (
     Container_InsHashNode(&node->node, bucket);
 }
 
+inline void
+Container_InitStringKey (
+                         const char*                           string,
+                         size_t                                length,
+                         struct container__string_key* restrict key
+                        )
+{
+    key->string     = string;
+    key->length     = length;
+    key->value_hash = Container_HashBytes(string, length, CONTAINER__HASHFN_DEFAULT_SEED);
+    key->prefix     = 0;
+
+    memcpy(
+           &key->prefix,
+           string,
+           length < CONTAINER__STRING_KEY_PREFIX_SIZE ? length : CONTAINER__STRING_KEY_PREFIX_SIZE
+          );
+}
+
+inline enum container__hash_cmp_result
+Container_StringKeyHashTest (
+                             struct container__string_key l_value,
+                             struct container__string_key r_value
+                            )
+{
+    if(l_value.value_hash != r_value.value_hash ||
+       l_value.length != r_value.length ||
+       l_value.prefix != r_value.prefix)
+    {
+        return container__hash_node_not_equal;
+    }
+
+    if(
+       l_value.length > CONTAINER__STRING_KEY_PREFIX_SIZE &&
+       memcmp(
+              l_value.string+CONTAINER__STRING_KEY_PREFIX_SIZE,
+              r_value.string+CONTAINER__STRING_KEY_PREFIX_SIZE,
+              l_value.length-CONTAINER__STRING_KEY_PREFIX_SIZE
+             ) != 0
+      )
+    {
+        return container__hash_node_not_equal;
+    }
+
+    return container__hash_node_equal;
+}
+
+inline unsigned int
+Container_StringKeyHashKeyValue (struct container__string_key value)
+{
+    return value.value_hash;
+}
+
+inline enum container__hash_cmp_result
+Container_StringKeyHashLookup (
+                               void*                                 lookup_value,
+                               struct container__hash_node* restrict existing_node,
+                               void*                                 user_data
+                              )
+{
+    struct container__string_key* restrict           key_lookup_value;
+    struct container__string_key_hash_node* restrict existing_key_node;
+    enum container__hash_cmp_result                  cmp_result;
+
+    key_lookup_value  = lookup_value;
+    existing_key_node = CONTAINER__CONTAINER_OF(
+                                                existing_node,
+                                                struct container__string_key_hash_node,
+                                                node
+                                               );
+
+    cmp_result = Container_StringKeyHashTest(*key_lookup_value, existing_key_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddStringKeyHash (
+                            struct container__string_key                     value,
+                            struct container__string_key_hash_node* restrict node,
+                            struct container__hash* restrict                 hash
+                           )
+{
+    node->value = value;
+
+    Container_AddHashNode(
+                          value.value_hash,
+                          &node->node,
+                          hash
+                         );
+}
+
+inline void
+Container_InsStringKeyHash (
+                            struct container__string_key                     value,
+                            struct container__string_key_hash_node* restrict node,
+                            struct container__hash_bucket* restrict          bucket
+                           )
+{
+    node->value = value;
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
+inline const char*
+Container_InlineStringHashValue (struct container__inline_string_hash_node* restrict node)
+{
+    if(node->length < CONTAINER__INLINE_STRING_SIZE)
+        return node->value.internal;
+
+    return node->value.external;
+}
+
+inline enum container__hash_cmp_result
+Container_InlineStringHashTest (
+                                const struct container__string_key* restrict        l_value,
+                                struct container__inline_string_hash_node* restrict r_value
+                               )
+{
+    if(l_value->value_hash != r_value->value_hash || l_value->length != r_value->length)
+        return container__hash_node_not_equal;
+
+    if(memcmp(l_value->string, Container_InlineStringHashValue(r_value), l_value->length) != 0)
+        return container__hash_node_not_equal;
+
+    return container__hash_node_equal;
+}
+
+inline enum container__hash_cmp_result
+Container_InlineStringHashLookup (
+                                  void*                                 lookup_value,
+                                  struct container__hash_node* restrict existing_node,
+                                  void*                                 user_data
+                                 )
+{
+    struct container__inline_string_hash_node* restrict existing_inline_node;
+    enum container__hash_cmp_result                     cmp_result;
+
+    existing_inline_node = CONTAINER__CONTAINER_OF(
+                                                   existing_node,
+                                                   struct container__inline_string_hash_node,
+                                                   node
+                                                  );
+
+    cmp_result = Container_InlineStringHashTest(lookup_value, existing_inline_node);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddInlineStringHash (
+                               const struct container__string_key* restrict        value,
+                               struct container__inline_string_hash_node* restrict node,
+                               struct container__hash* restrict                    hash
+                              )
+{
+    Container_InsInlineStringHash(value, node, Container_LookupHashBucket(value->value_hash, hash));
+}
+
+inline void
+Container_InsInlineStringHash (
+                               const struct container__string_key* restrict        value,
+                               struct container__inline_string_hash_node* restrict node,
+                               struct container__hash_bucket* restrict             bucket
+                              )
+{
+    node->value_hash = value->value_hash;
+    node->length     = (unsigned int)value->length;
+
+    if(value->length < CONTAINER__INLINE_STRING_SIZE)
+    {
+        memcpy(node->value.internal, value->string, value->length);
+
+        node->value.internal[value->length] = '\0';
+    }
+    else
+    {
+        node->value.external = value->string;
+    }
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
+inline enum container__hash_cmp_result
+Container_Blob16HashTest (struct container__blob16 l_value, struct container__blob16 r_value)
+{
+    if(Container_Blob16Equal(l_value.bytes, r_value.bytes))
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+inline enum container__hash_cmp_result
+Container_Blob16HashLookup (
+                            void*                                 lookup_value,
+                            struct container__hash_node* restrict existing_node,
+                            void*                                 user_data
+                           )
+{
+    struct container__blob16* restrict           blob_lookup_value;
+    struct container__blob16_hash_node* restrict existing_blob_node;
+    enum container__hash_cmp_result              cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob16_hash_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_Blob16HashTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlob16Hash (
+                         struct container__blob16                     value,
+                         unsigned int                                 value_hash,
+                         struct container__blob16_hash_node* restrict node,
+                         struct container__hash* restrict             hash
+                        )
+{
+    node->value = value;
+
+    Container_AddHashNode(
+                          value_hash,
+                          &node->node,
+                          hash
+                         );
+}
+
+inline void
+Container_InsBlob16Hash (
+                         struct container__blob16                     value,
+                         struct container__blob16_hash_node* restrict node,
+                         struct container__hash_bucket* restrict      bucket
+                        )
+{
+    node->value = value;
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
+inline enum container__hash_cmp_result
+Container_Blob32HashTest (struct container__blob32 l_value, struct container__blob32 r_value)
+{
+    if(Container_Blob32Equal(l_value.bytes, r_value.bytes))
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+inline enum container__hash_cmp_result
+Container_Blob32HashLookup (
+                            void*                                 lookup_value,
+                            struct container__hash_node* restrict existing_node,
+                            void*                                 user_data
+                           )
+{
+    struct container__blob32* restrict           blob_lookup_value;
+    struct container__blob32_hash_node* restrict existing_blob_node;
+    enum container__hash_cmp_result              cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob32_hash_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_Blob32HashTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlob32Hash (
+                         struct container__blob32                     value,
+                         unsigned int                                 value_hash,
+                         struct container__blob32_hash_node* restrict node,
+                         struct container__hash* restrict             hash
+                        )
+{
+    node->value = value;
+
+    Container_AddHashNode(
+                          value_hash,
+                          &node->node,
+                          hash
+                         );
+}
+
+inline void
+Container_InsBlob32Hash (
+                         struct container__blob32                     value,
+                         struct container__blob32_hash_node* restrict node,
+                         struct container__hash_bucket* restrict      bucket
+                        )
+{
+    node->value = value;
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
+inline enum container__hash_cmp_result
+Container_BlobHashTest (struct container__blob l_value, struct container__blob r_value)
+{
+    if(l_value.value_hash != r_value.value_hash || l_value.length != r_value.length)
+        return container__hash_node_not_equal;
+
+    if(!Container_BlobEqual(l_value.bytes, r_value.bytes, l_value.length))
+        return container__hash_node_not_equal;
+
+    return container__hash_node_equal;
+}
+
+inline unsigned int
+Container_BlobHashKeyValue (struct container__blob value)
+{
+    return value.value_hash;
+}
+
+inline enum container__hash_cmp_result
+Container_BlobHashLookup (
+                          void*                                 lookup_value,
+                          struct container__hash_node* restrict existing_node,
+                          void*                                 user_data
+                         )
+{
+    struct container__blob* restrict           blob_lookup_value;
+    struct container__blob_hash_node* restrict existing_blob_node;
+    enum container__hash_cmp_result            cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob_hash_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_BlobHashTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlobHash (
+                       struct container__blob                     value,
+                       struct container__blob_hash_node* restrict node,
+                       struct container__hash* restrict           hash
+                      )
+{
+    node->value = value;
+
+    Container_AddHashNode(
+                          value.value_hash,
+                          &node->node,
+                          hash
+                         );
+}
+
+inline void
+Container_InsBlobHash (
+                       struct container__blob                     value,
+                       struct container__blob_hash_node* restrict node,
+                       struct container__hash_bucket* restrict    bucket
+                      )
+{
+    node->value = value;
+
+    Container_InsHashNode(&node->node, bucket);
+}
+
+
+inline unsigned int
+Container_StringHashKeyValue (char* value)
+{
+    return Container_HashString(value, CONTAINER__HASHFN_DEFAULT_SEED);
+}
+
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              IntHashKey,
+                              struct container__int_hash_node,
+                              node,
+                              int,
+                              value,
+                              Container_HashInt,
+                              Container_IntHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              UIntHashKey,
+                              struct container__uint_hash_node,
+                              node,
+                              unsigned int,
+                              value,
+                              Container_HashUInt,
+                              Container_UIntHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              LongHashKey,
+                              struct container__long_hash_node,
+                              node,
+                              long long,
+                              value,
+                              Container_HashLong,
+                              Container_LongHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              ULongHashKey,
+                              struct container__ulong_hash_node,
+                              node,
+                              unsigned long long,
+                              value,
+                              Container_HashULong,
+                              Container_ULongHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              StringHashKey,
+                              struct container__string_hash_node,
+                              node,
+                              char*,
+                              value,
+                              Container_StringHashKeyValue,
+                              Container_StringHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              StringKeyHashKey,
+                              struct container__string_key_hash_node,
+                              node,
+                              struct container__string_key,
+                              value,
+                              Container_StringKeyHashKeyValue,
+                              Container_StringKeyHashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              Blob16HashKey,
+                              struct container__blob16_hash_node,
+                              node,
+                              struct container__blob16,
+                              value,
+                              Container_HashBlob16,
+                              Container_Blob16HashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              Blob32HashKey,
+                              struct container__blob32_hash_node,
+                              node,
+                              struct container__blob32,
+                              value,
+                              Container_HashBlob32,
+                              Container_Blob32HashTest
+                             )
+
+CONTAINER__DEFINE_EXTERN_HASH(
+                              Container_,
+                              BlobHashKey,
+                              struct container__blob_hash_node,
+                              node,
+                              struct container__blob,
+                              value,
+                              Container_BlobHashKeyValue,
+                              Container_BlobHashTest
+                             )
 
 #endif
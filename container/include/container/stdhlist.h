@@ -20,14 +20,16 @@
  */
 
 /*
-    Standard types for use with the hlist container
+    Standard types for use with the hlist container.  The blob nodes hold binary keys,
+    compared with the vectorized equality functions in blob.h
  */
 
 
-#ifndef _CONTAINER__HLIST_H_
-#define _CONTAINER__HLIST_H_
+#ifndef _CONTAINER__STDHLIST_H_
+#define _CONTAINER__STDHLIST_H_
 
 
+#include <container/blob.h>
 #include <container/sync.h>
 #include <container/hlist.h>
 
@@ -62,6 +64,24 @@ struct container__string_hlist_node
     struct container__hlist_node node;
 };
 
+struct container__blob16_hlist_node
+{
+    struct container__blob16     value;
+    struct container__hlist_node node;
+};
+
+struct container__blob32_hlist_node
+{
+    struct container__blob32     value;
+    struct container__hlist_node node;
+};
+
+struct container__blob_hlist_node
+{
+    struct container__blob       value;
+    struct container__hlist_node node;
+};
+
 
 inline enum container__hlist_cmp_result
 Container_IntHListTest (int, int);
@@ -211,6 +231,93 @@ Container_InsStringHList (
                          );
 
 
+inline enum container__hlist_cmp_result
+Container_Blob16HListTest (struct container__blob16, struct container__blob16);
+
+inline enum container__hlist_cmp_result
+Container_Blob16HListLookup (
+                             void*,
+                             struct container__hlist_node* restrict,
+                             void*
+                            );
+
+inline void
+Container_AddBlob16HList (
+                          struct container__blob16,
+                          unsigned int,
+                          struct container__blob16_hlist_node* restrict,
+                          void*,
+                          container__lock_sync_type,
+                          container__unlock_sync_type,
+                          struct container__hlist* restrict
+                         );
+
+inline void
+Container_InsBlob16HList (
+                          struct container__blob16,
+                          struct container__blob16_hlist_node* restrict,
+                          struct container__hash_bucket* restrict,
+                          struct container__hlist* restrict
+                         );
+
+inline enum container__hlist_cmp_result
+Container_Blob32HListTest (struct container__blob32, struct container__blob32);
+
+inline enum container__hlist_cmp_result
+Container_Blob32HListLookup (
+                             void*,
+                             struct container__hlist_node* restrict,
+                             void*
+                            );
+
+inline void
+Container_AddBlob32HList (
+                          struct container__blob32,
+                          unsigned int,
+                          struct container__blob32_hlist_node* restrict,
+                          void*,
+                          container__lock_sync_type,
+                          container__unlock_sync_type,
+                          struct container__hlist* restrict
+                         );
+
+inline void
+Container_InsBlob32HList (
+                          struct container__blob32,
+                          struct container__blob32_hlist_node* restrict,
+                          struct container__hash_bucket* restrict,
+                          struct container__hlist* restrict
+                         );
+
+inline enum container__hlist_cmp_result
+Container_BlobHListTest (struct container__blob, struct container__blob);
+
+inline enum container__hlist_cmp_result
+Container_BlobHListLookup (
+                           void*,
+                           struct container__hlist_node* restrict,
+                           void*
+                          );
+
+inline void
+Container_AddBlobHList (
+                        struct container__blob,
+                        struct container__blob_hlist_node* restrict,
+                        void*,
+                        container__lock_sync_type,
+                        container__unlock_sync_type,
+                        struct container__hlist* restrict
+                       );
+
+inline void
+Container_InsBlobHList (
+                        struct container__blob,
+                        struct container__blob_hlist_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__hlist* restrict
+                       );
+
+
 #include <string.h>
 
 
@@ -267,7 +374,7 @@ Container_AddIntHList (
                            hlist
                           );
 
-    Container_UnlockSync(sync, lock_sync);
+    Container_UnlockSync(sync, unlock_sync);
 }
 
 inline void
@@ -336,7 +443,7 @@ Container_AddUIntHList (
                            hlist
                           );
 
-    Container_UnlockSync(sync, lock_sync);
+    Container_UnlockSync(sync, unlock_sync);
 }
 
 inline void
@@ -405,7 +512,7 @@ Container_AddLongHList (
                            hlist
                           );
 
-    Container_UnlockSync(sync, lock_sync);
+    Container_UnlockSync(sync, unlock_sync);
 }
 
 inline void
@@ -474,7 +581,7 @@ Container_AddULongHList (
                            hlist
                           );
 
-    Container_UnlockSync(sync, lock_sync);
+    Container_UnlockSync(sync, unlock_sync);
 }
 
 inline void
@@ -546,7 +653,7 @@ Container_AddStringHList (
                            hlist
                           );
 
-    Container_UnlockSync(sync, lock_sync);
+    Container_UnlockSync(sync, unlock_sync);
 }
 
 inline void
@@ -562,5 +669,214 @@ Container_InsStringHList (
     Container_InsHListNode(&node->node, bucket, hlist);
 }
 
+inline enum container__hlist_cmp_result
+Container_Blob16HListTest (struct container__blob16 l_value, struct container__blob16 r_value)
+{
+    if(Container_Blob16Equal(l_value.bytes, r_value.bytes))
+        return container__hlist_node_equal;
+
+    return container__hlist_node_not_equal;
+}
+
+inline enum container__hlist_cmp_result
+Container_Blob16HListLookup (
+                             void*                                  lookup_value,
+                             struct container__hlist_node* restrict existing_node,
+                             void*                                  user_data
+                            )
+{
+    struct container__blob16* restrict            blob_lookup_value;
+    struct container__blob16_hlist_node* restrict existing_blob_node;
+    enum container__hlist_cmp_result              cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob16_hlist_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_Blob16HListTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlob16HList (
+                          struct container__blob16                      value,
+                          unsigned int                                  value_hash,
+                          struct container__blob16_hlist_node* restrict node,
+                          void*                                         sync,
+                          container__lock_sync_type                     lock_sync,
+                          container__unlock_sync_type                   unlock_sync,
+                          struct container__hlist* restrict             hlist
+                         )
+{
+    node->value = value;
+
+    Container_LockSync(sync, lock_sync);
+
+    Container_AddHListNode(
+                           value_hash,
+                           &node->node,
+                           hlist
+                          );
+
+    Container_UnlockSync(sync, unlock_sync);
+}
+
+inline void
+Container_InsBlob16HList (
+                          struct container__blob16                      value,
+                          struct container__blob16_hlist_node* restrict node,
+                          struct container__hash_bucket* restrict       bucket,
+                          struct container__hlist* restrict             hlist
+                         )
+{
+    node->value = value;
+
+    Container_InsHListNode(&node->node, bucket, hlist);
+}
+
+inline enum container__hlist_cmp_result
+Container_Blob32HListTest (struct container__blob32 l_value, struct container__blob32 r_value)
+{
+    if(Container_Blob32Equal(l_value.bytes, r_value.bytes))
+        return container__hlist_node_equal;
+
+    return container__hlist_node_not_equal;
+}
+
+inline enum container__hlist_cmp_result
+Container_Blob32HListLookup (
+                             void*                                  lookup_value,
+                             struct container__hlist_node* restrict existing_node,
+                             void*                                  user_data
+                            )
+{
+    struct container__blob32* restrict            blob_lookup_value;
+    struct container__blob32_hlist_node* restrict existing_blob_node;
+    enum container__hlist_cmp_result              cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob32_hlist_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_Blob32HListTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlob32HList (
+                          struct container__blob32                      value,
+                          unsigned int                                  value_hash,
+                          struct container__blob32_hlist_node* restrict node,
+                          void*                                         sync,
+                          container__lock_sync_type                     lock_sync,
+                          container__unlock_sync_type                   unlock_sync,
+                          struct container__hlist* restrict             hlist
+                         )
+{
+    node->value = value;
+
+    Container_LockSync(sync, lock_sync);
+
+    Container_AddHListNode(
+                           value_hash,
+                           &node->node,
+                           hlist
+                          );
+
+    Container_UnlockSync(sync, unlock_sync);
+}
+
+inline void
+Container_InsBlob32HList (
+                          struct container__blob32                      value,
+                          struct container__blob32_hlist_node* restrict node,
+                          struct container__hash_bucket* restrict       bucket,
+                          struct container__hlist* restrict             hlist
+                         )
+{
+    node->value = value;
+
+    Container_InsHListNode(&node->node, bucket, hlist);
+}
+
+inline enum container__hlist_cmp_result
+Container_BlobHListTest (struct container__blob l_value, struct container__blob r_value)
+{
+    if(l_value.value_hash != r_value.value_hash || l_value.length != r_value.length)
+        return container__hlist_node_not_equal;
+
+    if(!Container_BlobEqual(l_value.bytes, r_value.bytes, l_value.length))
+        return container__hlist_node_not_equal;
+
+    return container__hlist_node_equal;
+}
+
+inline enum container__hlist_cmp_result
+Container_BlobHListLookup (
+                           void*                                  lookup_value,
+                           struct container__hlist_node* restrict existing_node,
+                           void*                                  user_data
+                          )
+{
+    struct container__blob* restrict            blob_lookup_value;
+    struct container__blob_hlist_node* restrict existing_blob_node;
+    enum container__hlist_cmp_result            cmp_result;
+
+    blob_lookup_value  = lookup_value;
+    existing_blob_node = CONTAINER__CONTAINER_OF(
+                                                 existing_node,
+                                                 struct container__blob_hlist_node,
+                                                 node
+                                                );
+
+    cmp_result = Container_BlobHListTest(*blob_lookup_value, existing_blob_node->value);
+
+    return cmp_result;
+}
+
+inline void
+Container_AddBlobHList (
+                        struct container__blob                      value,
+                        struct container__blob_hlist_node* restrict node,
+                        void*                                       sync,
+                        container__lock_sync_type                   lock_sync,
+                        container__unlock_sync_type                 unlock_sync,
+                        struct container__hlist* restrict           hlist
+                       )
+{
+    node->value = value;
+
+    Container_LockSync(sync, lock_sync);
+
+    Container_AddHListNode(
+                           value.value_hash,
+                           &node->node,
+                           hlist
+                          );
+
+    Container_UnlockSync(sync, unlock_sync);
+}
+
+inline void
+Container_InsBlobHList (
+                        struct container__blob                      value,
+                        struct container__blob_hlist_node* restrict node,
+                        struct container__hash_bucket* restrict     bucket,
+                        struct container__hlist* restrict           hlist
+                       )
+{
+    node->value = value;
+
+    Container_InsHListNode(&node->node, bucket, hlist);
+}
+
 
 #endif
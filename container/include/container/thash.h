@@ -0,0 +1,628 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+/*
+    The thash container manages a hash intended for keys supplied by untrusted sources.  Each
+    thash has its own seed, which is mixed into every hash value before a bucket is selected,
+    so that which keys share a bucket can't be predicted without knowing the seed.  Should a
+    bucket still grow beyond CONTAINER__THASH_TREE_THRESHOLD nodes, its nodes are moved into a
+    bst ordered by their seeded hash values, so that lookups in the bucket take logarithmic
+    rather than linear time.  The bucket returns to a list once it shrinks back to half the
+    threshold.
+
+    The seed does not protect against keys whose hash values are themselves equal, so hash
+    values should be computed with a seeded hash function, such as Container_HashBytes with
+    the seed returned by Container_THashSeed
+ */
+
+
+#ifndef _CONTAINER__THASH_H_
+#define _CONTAINER__THASH_H_
+
+
+#include <container/error.h>
+#include <container/alloc.h>
+#include <container/clist.h>
+#include <container/bst.h>
+#include <container/hash.h>
+
+
+/*
+    The number of nodes a bucket may hold before its nodes are moved into a tree
+ */
+#define CONTAINER__THASH_TREE_THRESHOLD 8
+
+
+/*
+    The node data to be placed in each thash element
+ */
+struct container__thash_node
+{
+    unsigned int                 value_hash;
+    struct container__clist_node list_node;
+    struct container__bst_node   tree_node;
+};
+
+/*
+    The buckets which make up the thash container.  Nodes are held in the node list until
+    the bucket grows too long, and in the node tree from then on
+
+    Accessible members:
+        node_count -- the number of nodes in the bucket
+ */
+struct container__thash_bucket
+{
+    unsigned int            node_count;
+    struct container__clist node_list;
+    struct container__bst   node_tree;
+};
+
+/*
+    The thash container itself
+
+    Accessible members:
+        allocator -- the allocator used for the buckets
+ */
+struct container__thash
+{
+    unsigned int                       bucket_count;
+    unsigned int                       seed;
+    struct container__thash_bucket*    buckets;
+    const struct container__allocator* allocator;
+};
+
+
+/*
+    The required type for a user-defined thash lookup function
+
+    For example:
+        enum container__hash_cmp_result
+        MyLookup (
+                  void*                                  id_to_lookup,
+                  struct container__thash_node* restrict cmp_node,
+                  void*                                  user_data
+                 )
+        {
+            struct my_element* element;
+
+            element = CONTAINER__CONTAINER_OF(cmp_node, struct my_element, node);
+
+            if(element->my_id == *(my_id_type*)id_to_lookup)
+                return container__hash_node_equal;
+
+            return container__hash_node_not_equal;
+        }
+ */
+typedef enum container__hash_cmp_result
+(*container__thash_lookup_type) (
+                                 void*,
+                                 struct container__thash_node* restrict,
+                                 void*
+                                );
+
+
+/*
+     Initialize a thash with the specified seed.  The container will be empty upon
+     initialization
+
+     Syntax:
+         Container_InitTHash(bucket_count, my_buckets_array, my_seed, &my_thash);
+ */
+inline void
+Container_InitTHash (
+                     unsigned int,
+                     struct container__thash_bucket* restrict,
+                     unsigned int,
+                     struct container__thash* restrict
+                    );
+
+/*
+     Allocate thash buckets and initialize a thash with a random seed, read from /dev/urandom
+     where available.  The container will be empty upon initialization
+
+     Syntax:
+         error = Container_CreateTHash(bucket_count, &my_thash);
+ */
+inline enum container__error_code
+Container_CreateTHash (unsigned int, struct container__thash* restrict);
+
+/*
+     Allocate thash buckets using an allocator and initialize a thash with a random seed, as
+     with Container_CreateTHash
+
+     Syntax:
+         error = Container_CreateTHashWithAllocator(bucket_count, &my_allocator, &my_thash);
+ */
+inline enum container__error_code
+Container_CreateTHashWithAllocator (
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__thash* restrict
+                                   );
+
+/*
+    Cleanup a previously created thash
+
+    Syntax:
+        Container_DestroyTHash(&my_thash);
+ */
+inline void
+Container_DestroyTHash (struct container__thash* restrict);
+
+
+/*
+    Return the seed of a thash, for use with a seeded hash function
+
+    Syntax:
+        value_hash = Container_HashString(my_key, Container_THashSeed(&my_thash));
+ */
+inline unsigned int
+Container_THashSeed (struct container__thash* restrict);
+
+
+/*
+    Lookup a node in the thash.  The found node is returned, or NULL if no node was found
+
+    Syntax:
+        found_node = Container_LookupTHashNode(
+                                               MyHashValue(lookup_id),
+                                               &lookup_id,
+                                               &my_thash,
+                                               &MyLookup,
+                                               my_user_data
+                                              );
+ */
+inline struct container__thash_node*
+Container_LookupTHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__thash* restrict,
+                           container__thash_lookup_type,
+                           void*
+                          );
+
+
+/*
+     Add a node to the thash, specifying the hash value for the node
+
+     Syntax:
+         Container_AddTHashNode(MyHashValue(my_element.my_id), &my_element.node, &my_thash);
+ */
+inline void
+Container_AddTHashNode (
+                        unsigned int,
+                        struct container__thash_node* restrict,
+                        struct container__thash* restrict
+                       );
+
+/*
+    Remove a node from the thash
+
+    Syntax:
+        Container_RemoveTHashNode(&my_element.node, &my_thash);
+ */
+inline void
+Container_RemoveTHashNode (
+                           struct container__thash_node* restrict,
+                           struct container__thash* restrict
+                          );
+
+
+#include <container/utils.h>
+#include <container/hashfn.h>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+inline unsigned int
+Container_RandomTHashSeed (struct container__thash* restrict);
+
+inline unsigned int
+Container_SeedTHashValue (unsigned int, struct container__thash* restrict);
+
+inline struct container__thash_bucket*
+Container_THashBucket (unsigned int, struct container__thash* restrict);
+
+inline enum container__bst_cmp_result
+Container_THashTreeLookup (void*, struct container__bst_node* restrict, void*);
+
+inline enum container__bst_cmp_result
+Container_THashTreeCmp (
+                        struct container__bst_node* restrict,
+                        struct container__bst_node* restrict,
+                        void*
+                       );
+
+inline void
+Container_GrowTHashTree (struct container__thash_bucket* restrict);
+
+inline void
+Container_ShrinkTHashTree (struct container__thash_bucket* restrict);
+
+inline struct container__thash_node*
+Container_LookupTHashTree (
+                           unsigned int,
+                           void*,
+                           struct container__thash_bucket* restrict,
+                           container__thash_lookup_type,
+                           void*
+                          );
+
+
+inline unsigned int
+Container_RandomTHashSeed (struct container__thash* restrict thash)
+{
+    unsigned int seed;
+    FILE*        random_file;
+
+    random_file = fopen("/dev/urandom", "rb");
+    if(random_file != NULL)
+    {
+        size_t read_count;
+
+        read_count = fread(&seed, sizeof(seed), 1, random_file);
+
+        fclose(random_file);
+
+        if(read_count == 1)
+            return seed;
+    }
+
+    /*
+        Without a random source, fall back to values which at least differ between tables
+        and between runs
+     */
+    seed  = Container_HashULong((unsigned long long)time(NULL));
+    seed ^= Container_HashULong((unsigned long long)clock());
+    seed ^= Container_HashULong((unsigned long long)(size_t)thash);
+
+    return seed;
+}
+
+inline unsigned int
+Container_SeedTHashValue (unsigned int value_hash, struct container__thash* restrict thash)
+{
+    return Container_HashUInt(value_hash^thash->seed);
+}
+
+inline struct container__thash_bucket*
+Container_THashBucket (unsigned int seeded_hash, struct container__thash* restrict thash)
+{
+    return &thash->buckets[seeded_hash%thash->bucket_count];
+}
+
+inline enum container__bst_cmp_result
+Container_THashTreeLookup (
+                           void*                                seeded_hash,
+                           struct container__bst_node* restrict cmp_node,
+                           void*                                user_data
+                          )
+{
+    struct container__thash_node* thash_node;
+    unsigned int                  lookup_hash;
+
+    thash_node  = CONTAINER__CONTAINER_OF(cmp_node, struct container__thash_node, tree_node);
+    lookup_hash = *(unsigned int*)seeded_hash;
+
+    if(lookup_hash < thash_node->value_hash)
+        return container__bst_node_left;
+    else if(lookup_hash > thash_node->value_hash)
+        return container__bst_node_right;
+
+    return container__bst_node_equal;
+}
+
+inline enum container__bst_cmp_result
+Container_THashTreeCmp (
+                        struct container__bst_node* restrict new_node,
+                        struct container__bst_node* restrict cmp_node,
+                        void*                                user_data
+                       )
+{
+    struct container__thash_node* new_thash_node;
+
+    new_thash_node = CONTAINER__CONTAINER_OF(new_node, struct container__thash_node, tree_node);
+
+    return Container_THashTreeLookup(&new_thash_node->value_hash, cmp_node, user_data);
+}
+
+inline void
+Container_GrowTHashTree (struct container__thash_bucket* restrict bucket)
+{
+    while(Container_CListState(&bucket->node_list) != container__clist_empty)
+    {
+        struct container__thash_node* thash_node;
+
+        thash_node = CONTAINER__CONTAINER_OF(
+                                             bucket->node_list.sentinel.next,
+                                             struct container__thash_node,
+                                             list_node
+                                            );
+
+        Container_RemoveCListHead(&bucket->node_list);
+        Container_AddBSTNode(
+                             &thash_node->tree_node,
+                             &bucket->node_tree,
+                             &Container_THashTreeCmp,
+                             NULL
+                            );
+    }
+}
+
+inline void
+Container_ShrinkTHashTree (struct container__thash_bucket* restrict bucket)
+{
+    struct container__bst_scan scan;
+
+    for(
+        Container_StartBSTScanRight(&bucket->node_tree, &scan);
+        Container_BSTScanState(&scan) != container__bst_scan_finished;
+        Container_ResumeBSTScanRight(&bucket->node_tree, &scan)
+       )
+    {
+        struct container__thash_node* thash_node;
+
+        thash_node = CONTAINER__CONTAINER_OF(
+                                             scan.current_node,
+                                             struct container__thash_node,
+                                             tree_node
+                                            );
+
+        Container_AddCListTail(&thash_node->list_node, &bucket->node_list);
+    }
+
+    Container_ResetBST(&bucket->node_tree);
+}
+
+inline struct container__thash_node*
+Container_LookupTHashTree (
+                           unsigned int                             seeded_hash,
+                           void*                                    value,
+                           struct container__thash_bucket* restrict bucket,
+                           container__thash_lookup_type             lookup,
+                           void*                                    user_data
+                          )
+{
+    struct container__bst_node* closest_node;
+    struct container__bst_scan  scan;
+    enum container__error_code  error;
+
+    error = Container_LookupBSTNode(
+                                    &seeded_hash,
+                                    &bucket->node_tree,
+                                    &Container_THashTreeLookup,
+                                    NULL,
+                                    &closest_node
+                                   );
+    if(error != container__error_none)
+        return NULL;
+
+    /*
+        Nodes with equal hash values are adjacent in the tree ordering, but the node found
+        may be any one of them, so check every neighbour with the same hash value
+     */
+    Container_StartBSTScanNode(closest_node, &bucket->node_tree, &scan);
+    while(Container_BSTScanState(&scan) != container__bst_scan_finished)
+    {
+        struct container__thash_node* thash_node;
+
+        thash_node = CONTAINER__CONTAINER_OF(
+                                             scan.current_node,
+                                             struct container__thash_node,
+                                             tree_node
+                                            );
+        if(thash_node->value_hash != seeded_hash)
+            break;
+
+        if((*lookup)(value, thash_node, user_data) == container__hash_node_equal)
+            return thash_node;
+
+        Container_ResumeBSTScanLeft(&bucket->node_tree, &scan);
+    }
+
+    Container_StartBSTScanNode(closest_node, &bucket->node_tree, &scan);
+    for(
+        Container_ResumeBSTScanRight(&bucket->node_tree, &scan);
+        Container_BSTScanState(&scan) != container__bst_scan_finished;
+        Container_ResumeBSTScanRight(&bucket->node_tree, &scan)
+       )
+    {
+        struct container__thash_node* thash_node;
+
+        thash_node = CONTAINER__CONTAINER_OF(
+                                             scan.current_node,
+                                             struct container__thash_node,
+                                             tree_node
+                                            );
+        if(thash_node->value_hash != seeded_hash)
+            break;
+
+        if((*lookup)(value, thash_node, user_data) == container__hash_node_equal)
+            return thash_node;
+    }
+
+    return NULL;
+}
+
+
+inline void
+Container_InitTHash (
+                     unsigned int                             count,
+                     struct container__thash_bucket* restrict buckets,
+                     unsigned int                             seed,
+                     struct container__thash* restrict        thash
+                    )
+{
+    unsigned int index;
+
+    thash->bucket_count = count;
+    thash->seed         = seed;
+    thash->buckets      = buckets;
+    thash->allocator    = NULL;
+
+    for(index = 0; index < count; index++)
+    {
+        buckets[index].node_count = 0;
+
+        Container_InitCList(&buckets[index].node_list);
+        Container_InitBST(&buckets[index].node_tree);
+    }
+}
+
+inline enum container__error_code
+Container_CreateTHash (unsigned int count, struct container__thash* restrict thash)
+{
+    return Container_CreateTHashWithAllocator(count, NULL, thash);
+}
+
+inline enum container__error_code
+Container_CreateTHashWithAllocator (
+                                    unsigned int                       count,
+                                    const struct container__allocator* allocator,
+                                    struct container__thash* restrict  thash
+                                   )
+{
+    struct container__thash_bucket* buckets;
+
+    buckets = Container_AllocMemory(sizeof(struct container__thash_bucket)*count, allocator);
+    if(buckets == NULL)
+        return container__error_memory_alloc;
+
+    Container_InitTHash(count, buckets, Container_RandomTHashSeed(thash), thash);
+
+    thash->allocator = allocator;
+
+    return container__error_none;
+}
+
+inline void
+Container_DestroyTHash (struct container__thash* restrict thash)
+{
+    Container_FreeMemory(
+                         thash->buckets,
+                         sizeof(struct container__thash_bucket)*thash->bucket_count,
+                         thash->allocator
+                        );
+}
+
+inline unsigned int
+Container_THashSeed (struct container__thash* restrict thash)
+{
+    return thash->seed;
+}
+
+inline struct container__thash_node*
+Container_LookupTHashNode (
+                           unsigned int                      value_hash,
+                           void*                             value,
+                           struct container__thash* restrict thash,
+                           container__thash_lookup_type      lookup,
+                           void*                             user_data
+                          )
+{
+    struct container__thash_bucket* bucket;
+    struct container__clist_node*   sentinel;
+    struct container__clist_node*   list_node;
+    unsigned int                    seeded_hash;
+
+    seeded_hash = Container_SeedTHashValue(value_hash, thash);
+    bucket      = Container_THashBucket(seeded_hash, thash);
+
+    if(Container_BSTState(&bucket->node_tree) == container__bst_populated)
+        return Container_LookupTHashTree(seeded_hash, value, bucket, lookup, user_data);
+
+    sentinel = &bucket->node_list.sentinel;
+    for(list_node = sentinel->next; list_node != sentinel; list_node = list_node->next)
+    {
+        struct container__thash_node* thash_node;
+
+        thash_node = CONTAINER__CONTAINER_OF(list_node, struct container__thash_node, list_node);
+        if(thash_node->value_hash != seeded_hash)
+            continue;
+
+        if((*lookup)(value, thash_node, user_data) == container__hash_node_equal)
+            return thash_node;
+    }
+
+    return NULL;
+}
+
+inline void
+Container_AddTHashNode (
+                        unsigned int                           value_hash,
+                        struct container__thash_node* restrict node,
+                        struct container__thash* restrict      thash
+                       )
+{
+    struct container__thash_bucket* bucket;
+
+    node->value_hash = Container_SeedTHashValue(value_hash, thash);
+
+    bucket = Container_THashBucket(node->value_hash, thash);
+    bucket->node_count++;
+
+    if(Container_BSTState(&bucket->node_tree) == container__bst_populated)
+    {
+        Container_AddBSTNode(
+                             &node->tree_node,
+                             &bucket->node_tree,
+                             &Container_THashTreeCmp,
+                             NULL
+                            );
+
+        return;
+    }
+
+    Container_AddCListHead(&node->list_node, &bucket->node_list);
+
+    if(bucket->node_count > CONTAINER__THASH_TREE_THRESHOLD)
+        Container_GrowTHashTree(bucket);
+}
+
+inline void
+Container_RemoveTHashNode (
+                           struct container__thash_node* restrict node,
+                           struct container__thash* restrict      thash
+                          )
+{
+    struct container__thash_bucket* bucket;
+
+    bucket = Container_THashBucket(node->value_hash, thash);
+    bucket->node_count--;
+
+    if(Container_BSTState(&bucket->node_tree) == container__bst_empty)
+    {
+        Container_RemoveCListNode(&node->list_node);
+
+        return;
+    }
+
+    Container_RemoveBSTNode(&node->tree_node, &bucket->node_tree);
+
+    if(bucket->node_count <= CONTAINER__THASH_TREE_THRESHOLD/2)
+        Container_ShrinkTHashTree(bucket);
+}
+
+
+#endif
@@ -65,5 +65,18 @@
  */
 #define CONTAINER__STD_CONTAINER_OF(address, type, member) CONTAINER__CONTAINER_OF(address, type, member.node)
 
+/*
+    Hints that the memory at the specified address will be read soon, so that the cache miss
+    may overlap with other work.  Expands to nothing on compilers without a prefetch builtin
+
+    For example:
+        CONTAINER__PREFETCH(&my_buckets[next_index]);
+ */
+#if defined(__GNUC__)
+#define CONTAINER__PREFETCH(address) __builtin_prefetch(address)
+#else
+#define CONTAINER__PREFETCH(address) ((void)(address))
+#endif
+
 
 #endif
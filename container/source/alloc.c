@@ -0,0 +1,14 @@
+#include <container/alloc.h>
+
+
+extern void*
+Container_AllocMemory (size_t, const struct container__allocator*);
+
+extern void*
+Container_AllocZeroMemory (size_t, const struct container__allocator*);
+
+extern void*
+Container_ReallocMemory (void*, size_t, size_t, const struct container__allocator*);
+
+extern void
+Container_FreeMemory (void*, size_t, const struct container__allocator*);
@@ -0,0 +1,35 @@
+#include <container/blob.h>
+
+
+extern void
+Container_InitBlob (const void*, size_t, struct container__blob* restrict);
+
+extern unsigned int
+Container_HashBlob16 (struct container__blob16);
+
+extern unsigned int
+Container_HashBlob32 (struct container__blob32);
+
+extern int
+Container_Blob16Equal (const void* restrict, const void* restrict);
+
+extern int
+Container_Blob32Equal (const void* restrict, const void* restrict);
+
+extern int
+Container_BlobEqual (const void* restrict, const void* restrict, size_t);
+
+
+extern int
+Container_Blob64Equal (const unsigned char* restrict, const unsigned char* restrict);
+
+extern int
+Container_BlobEqualWide (const unsigned char* restrict, const unsigned char* restrict, size_t);
+
+#if defined(CONTAINER__BLOB_AVX2_DISPATCH)
+extern int
+Container_Blob64EqualAVX2 (const unsigned char* restrict, const unsigned char* restrict);
+
+extern int
+Container_BlobEqualWideAVX2 (const unsigned char* restrict, const unsigned char* restrict, size_t);
+#endif
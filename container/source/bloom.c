@@ -0,0 +1,75 @@
+#include <container/bloom.h>
+
+
+extern enum container__error_code
+Container_CreateBloom (unsigned long, unsigned int, struct container__bloom* restrict);
+
+extern enum container__error_code
+Container_CreateBloomWithAllocator (
+                                    unsigned long,
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__bloom* restrict
+                                   );
+
+extern void
+Container_DestroyBloom (struct container__bloom* restrict);
+
+
+extern void
+Container_ResetBloom (struct container__bloom* restrict);
+
+
+extern void
+Container_AddBloomValue (unsigned int, struct container__bloom* restrict);
+
+extern void
+Container_RemoveBloomValue (struct container__bloom* restrict);
+
+extern enum container__bloom_result
+Container_TestBloomValue (unsigned int, struct container__bloom* restrict);
+
+
+extern struct container__hash_node*
+Container_LookupBloomHashNode (
+                               unsigned int,
+                               void*,
+                               struct container__bloom* restrict,
+                               struct container__hash* restrict,
+                               container__hash_lookup_type,
+                               void*,
+                               struct container__hash_bucket** restrict
+                              );
+
+extern void
+Container_AddBloomHashNode (
+                            unsigned int,
+                            struct container__hash_node* restrict,
+                            struct container__bloom* restrict,
+                            struct container__hash* restrict
+                           );
+
+extern void
+Container_RemoveBloomHashNode (
+                               struct container__hash_node* restrict,
+                               struct container__bloom* restrict
+                              );
+
+extern void
+Container_RebuildHashBloom (
+                            struct container__hash* restrict,
+                            container__hash_value_type,
+                            void*,
+                            struct container__bloom* restrict
+                           );
+
+
+extern void
+Container_BloomStats (struct container__bloom* restrict, struct container__bloom_stats* restrict);
+
+
+extern struct container__bloom_block*
+Container_BloomBlock (unsigned int, struct container__bloom* restrict);
+
+extern unsigned long long
+Container_BloomBit (unsigned int, unsigned int);
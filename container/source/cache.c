@@ -0,0 +1,104 @@
+#include <container/cache.h>
+
+
+extern enum container__error_code
+Container_CreateCache (
+                       unsigned int,
+                       enum container__cache_policy,
+                       unsigned int,
+                       size_t,
+                       container__cache_evict_type,
+                       void*,
+                       struct container__cache* restrict
+                      );
+
+extern enum container__error_code
+Container_CreateCacheWithAllocator (
+                                    unsigned int,
+                                    enum container__cache_policy,
+                                    unsigned int,
+                                    size_t,
+                                    container__cache_evict_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__cache* restrict
+                                   );
+
+extern void
+Container_DestroyCache (struct container__cache* restrict);
+
+
+extern struct container__cache_node*
+Container_LookupCacheNode (
+                           unsigned int,
+                           void*,
+                           struct container__cache* restrict,
+                           container__cache_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+extern struct container__cache_node*
+Container_PeekCacheNode (
+                         unsigned int,
+                         void*,
+                         struct container__cache* restrict,
+                         container__cache_lookup_type,
+                         void*,
+                         struct container__hash_bucket** restrict
+                        );
+
+extern void
+Container_TouchCacheNode (
+                          struct container__cache_node* restrict,
+                          struct container__cache* restrict
+                         );
+
+
+extern void
+Container_AddCacheNode (
+                        unsigned int,
+                        size_t,
+                        struct container__cache_node* restrict,
+                        struct container__cache* restrict
+                       );
+
+extern void
+Container_InsCacheNode (
+                        size_t,
+                        struct container__cache_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__cache* restrict
+                       );
+
+extern void
+Container_RemoveCacheNode (
+                           struct container__cache_node* restrict,
+                           struct container__cache* restrict
+                          );
+
+extern void
+Container_EvictCacheNode (struct container__cache* restrict);
+
+extern void
+Container_SetCacheLimits (unsigned int, size_t, struct container__cache* restrict);
+
+
+extern enum container__cache_state
+Container_CacheState (struct container__cache* restrict);
+
+
+extern enum container__hlist_cmp_result
+Container_CacheHListLookup (void*, struct container__hlist_node* restrict, void*);
+
+extern struct container__cache_node*
+Container_CacheTail (struct container__cache* restrict);
+
+extern void
+Container_EvictCacheNodeOf (
+                            struct container__cache_node* restrict,
+                            struct container__cache* restrict
+                           );
+
+extern void
+Container_MakeCacheRoom (unsigned int, size_t, struct container__cache* restrict);
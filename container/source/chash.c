@@ -0,0 +1,107 @@
+#include <container/chash.h>
+
+
+extern void
+Container_InitCHash (
+                     unsigned int,
+                     struct container__chash_bucket* restrict,
+                     struct container__chash* restrict
+                    );
+
+extern void
+Container_InitCHashShift (
+                          unsigned int,
+                          struct container__chash_bucket* restrict,
+                          struct container__chash* restrict
+                         );
+
+extern enum container__error_code
+Container_CreateCHash (unsigned int, struct container__chash* restrict);
+
+extern enum container__error_code
+Container_CreateCHashShift (unsigned int, struct container__chash* restrict);
+
+extern enum container__error_code
+Container_CreateCHashWithAllocator (
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__chash* restrict
+                                   );
+
+extern enum container__error_code
+Container_CreateCHashShiftWithAllocator (
+                                         unsigned int,
+                                         const struct container__allocator*,
+                                         struct container__chash* restrict
+                                        );
+
+extern void
+Container_DestroyCHash (struct container__chash* restrict);
+
+
+extern void
+Container_ResetCHash (struct container__chash* restrict);
+
+extern void
+Container_ResetCHashPart (unsigned int, unsigned int, struct container__chash* restrict);
+
+extern void
+Container_ResetCHashParallel (
+                              const struct container__hash_parallel*,
+                              struct container__chash* restrict
+                             );
+
+
+extern struct container__chash_bucket*
+Container_LookupCHashBucket (unsigned int, struct container__chash* restrict);
+
+extern struct container__chash_node*
+Container_LookupCHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__chash* restrict,
+                           container__chash_lookup_type,
+                           void*,
+                           struct container__chash_bucket** restrict
+                          );
+
+
+extern void
+Container_AddCHashNode (
+                        unsigned int,
+                        struct container__chash_node* restrict,
+                        struct container__chash* restrict
+                       );
+
+extern void
+Container_InsCHashNode (
+                        struct container__chash_node* restrict,
+                        struct container__chash_bucket* restrict
+                       );
+
+extern void
+Container_RemoveCHashNode (struct container__chash_node* restrict);
+
+
+extern enum container__chash_bucket_state
+Container_CHashBucketState (struct container__chash_bucket* restrict);
+
+
+extern void
+Container_StartCHashBucketScan (
+                                struct container__chash_bucket* restrict,
+                                struct container__chash_bucket_scan* restrict
+                               );
+
+extern void
+Container_ResumeCHashBucketScan (struct container__chash_bucket_scan* restrict);
+
+extern enum container__chash_bucket_scan_state
+Container_CHashBucketScanState (struct container__chash_bucket_scan* restrict);
+
+
+extern void
+Container_ResetCHashTask (unsigned int, void*);
+
+extern unsigned int
+Container_CHashBucketIndex (unsigned int, struct container__chash* restrict);
@@ -0,0 +1,162 @@
+#include <container/densehash.h>
+
+
+extern enum container__error_code
+Container_CreateDenseUIntHash (unsigned int, struct container__dense_uint_hash* restrict);
+
+extern enum container__error_code
+Container_CreateDenseUIntHashWithAllocator (
+                                            unsigned int,
+                                            const struct container__allocator*,
+                                            struct container__dense_uint_hash* restrict
+                                           );
+
+extern void
+Container_DestroyDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+extern void
+Container_ResetDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+
+extern struct container__dense_uint_hash_node*
+Container_LookupDenseUIntHash (
+                               unsigned int,
+                               struct container__dense_uint_hash* restrict,
+                               struct container__dense_hash_probe* restrict
+                              );
+
+extern enum container__error_code
+Container_AddDenseUIntHash (
+                            unsigned int,
+                            struct container__dense_uint_hash_node* restrict,
+                            struct container__dense_uint_hash* restrict
+                           );
+
+extern enum container__error_code
+Container_InsDenseUIntHash (
+                            unsigned int,
+                            struct container__dense_uint_hash_node* restrict,
+                            struct container__dense_hash_probe* restrict,
+                            struct container__dense_uint_hash* restrict
+                           );
+
+extern void
+Container_RemoveDenseUIntHash (
+                               struct container__dense_uint_hash_node* restrict,
+                               struct container__dense_uint_hash* restrict
+                              );
+
+
+extern void
+Container_StartDenseUIntHashScan (
+                                  struct container__dense_uint_hash* restrict,
+                                  struct container__dense_uint_hash_scan* restrict
+                                 );
+
+extern void
+Container_ResumeDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict,
+                                   struct container__dense_uint_hash_scan* restrict
+                                  );
+
+extern enum container__dense_hash_scan_state
+Container_DenseUIntHashScanState (struct container__dense_uint_hash_scan* restrict);
+
+
+extern enum container__error_code
+Container_CreateDenseULongHash (unsigned int, struct container__dense_ulong_hash* restrict);
+
+extern enum container__error_code
+Container_CreateDenseULongHashWithAllocator (
+                                             unsigned int,
+                                             const struct container__allocator*,
+                                             struct container__dense_ulong_hash* restrict
+                                            );
+
+extern void
+Container_DestroyDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+extern void
+Container_ResetDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+
+extern struct container__dense_ulong_hash_node*
+Container_LookupDenseULongHash (
+                                unsigned long long,
+                                struct container__dense_ulong_hash* restrict,
+                                struct container__dense_hash_probe* restrict
+                               );
+
+extern enum container__error_code
+Container_AddDenseULongHash (
+                             unsigned long long,
+                             struct container__dense_ulong_hash_node* restrict,
+                             struct container__dense_ulong_hash* restrict
+                            );
+
+extern enum container__error_code
+Container_InsDenseULongHash (
+                             unsigned long long,
+                             struct container__dense_ulong_hash_node* restrict,
+                             struct container__dense_hash_probe* restrict,
+                             struct container__dense_ulong_hash* restrict
+                            );
+
+extern void
+Container_RemoveDenseULongHash (
+                                struct container__dense_ulong_hash_node* restrict,
+                                struct container__dense_ulong_hash* restrict
+                               );
+
+
+extern void
+Container_StartDenseULongHashScan (
+                                   struct container__dense_ulong_hash* restrict,
+                                   struct container__dense_ulong_hash_scan* restrict
+                                  );
+
+extern void
+Container_ResumeDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict,
+                                    struct container__dense_ulong_hash_scan* restrict
+                                   );
+
+extern enum container__dense_hash_scan_state
+Container_DenseULongHashScanState (struct container__dense_ulong_hash_scan* restrict);
+
+
+extern unsigned int
+Container_DenseUIntHashHome (unsigned int, struct container__dense_uint_hash* restrict);
+
+extern unsigned int
+Container_FindDenseUIntHashSlot (unsigned int, struct container__dense_uint_hash* restrict);
+
+extern enum container__error_code
+Container_AllocDenseUIntHash (unsigned int, struct container__dense_uint_hash* restrict);
+
+extern enum container__error_code
+Container_GrowDenseUIntHash (struct container__dense_uint_hash* restrict);
+
+extern void
+Container_UpdateDenseUIntHashScan (
+                                   struct container__dense_uint_hash* restrict,
+                                   struct container__dense_uint_hash_scan* restrict
+                                  );
+
+extern unsigned int
+Container_DenseULongHashHome (unsigned long long, struct container__dense_ulong_hash* restrict);
+
+extern unsigned int
+Container_FindDenseULongHashSlot (unsigned long long, struct container__dense_ulong_hash* restrict);
+
+extern enum container__error_code
+Container_AllocDenseULongHash (unsigned int, struct container__dense_ulong_hash* restrict);
+
+extern enum container__error_code
+Container_GrowDenseULongHash (struct container__dense_ulong_hash* restrict);
+
+extern void
+Container_UpdateDenseULongHashScan (
+                                    struct container__dense_ulong_hash* restrict,
+                                    struct container__dense_ulong_hash_scan* restrict
+                                   );
@@ -0,0 +1,55 @@
+#include <container/epoch.h>
+
+
+extern void
+Container_InitEpoch (
+                     unsigned int,
+                     struct container__epoch_reader* restrict,
+                     container__epoch_reclaim_type,
+                     void*,
+                     struct container__epoch* restrict
+                    );
+
+extern enum container__error_code
+Container_CreateEpoch (
+                       unsigned int,
+                       container__epoch_reclaim_type,
+                       void*,
+                       struct container__epoch* restrict
+                      );
+
+extern enum container__error_code
+Container_CreateEpochWithAllocator (
+                                    unsigned int,
+                                    container__epoch_reclaim_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__epoch* restrict
+                                   );
+
+extern void
+Container_DestroyEpoch (struct container__epoch* restrict);
+
+
+extern void
+Container_EnterEpoch (unsigned int, struct container__epoch* restrict);
+
+extern void
+Container_ExitEpoch (unsigned int, struct container__epoch* restrict);
+
+
+extern void
+Container_RetireEpochNode (
+                           struct container__epoch_node* restrict,
+                           struct container__epoch* restrict
+                          );
+
+extern void
+Container_ReclaimEpoch (struct container__epoch* restrict);
+
+
+extern unsigned long
+Container_MinActiveEpoch (struct container__epoch* restrict);
+
+extern void
+Container_ReclaimEpochBefore (unsigned long, struct container__epoch* restrict);
@@ -0,0 +1,112 @@
+#include <container/flathash.h>
+
+
+extern enum container__error_code
+Container_CreateFlatHash (unsigned int, struct container__flathash* restrict);
+
+extern enum container__error_code
+Container_CreateFlatHashWithAllocator (
+                                       unsigned int,
+                                       const struct container__allocator*,
+                                       struct container__flathash* restrict
+                                      );
+
+extern void
+Container_DestroyFlatHash (struct container__flathash* restrict);
+
+
+extern void
+Container_ResetFlatHash (struct container__flathash* restrict);
+
+
+extern struct container__flathash_node*
+Container_LookupFlatHashNode (
+                              unsigned int,
+                              void*,
+                              struct container__flathash* restrict,
+                              container__flathash_lookup_type,
+                              void*,
+                              struct container__flathash_probe* restrict
+                             );
+
+
+extern enum container__error_code
+Container_AddFlatHashNode (
+                           unsigned int,
+                           struct container__flathash_node* restrict,
+                           struct container__flathash* restrict
+                          );
+
+extern enum container__error_code
+Container_InsFlatHashNode (
+                           struct container__flathash_node* restrict,
+                           struct container__flathash_probe* restrict,
+                           struct container__flathash* restrict
+                          );
+
+extern void
+Container_RemoveFlatHashNode (
+                              struct container__flathash_node* restrict,
+                              struct container__flathash* restrict
+                             );
+
+
+extern void
+Container_StartFlatHashScan (
+                             struct container__flathash* restrict,
+                             struct container__flathash_scan* restrict
+                            );
+
+extern void
+Container_ResumeFlatHashScan (
+                              struct container__flathash* restrict,
+                              struct container__flathash_scan* restrict
+                             );
+
+extern enum container__flathash_scan_state
+Container_FlatHashScanState (struct container__flathash_scan* restrict);
+
+
+extern unsigned int
+Container_FlatHashFirstMatch (unsigned int);
+
+extern unsigned int
+Container_MatchFlatHashGroup (const unsigned char* restrict, unsigned char);
+
+extern unsigned int
+Container_MatchFlatHashGroupFree (const unsigned char* restrict);
+
+extern unsigned int
+Container_MatchFlatHashGroupEmpty (const unsigned char* restrict);
+
+extern unsigned char
+Container_FlatHashTag (unsigned int);
+
+extern unsigned int
+Container_FlatHashGroupIndex (unsigned int, struct container__flathash* restrict);
+
+extern unsigned int
+Container_FlatHashCapacity (struct container__flathash* restrict);
+
+extern unsigned int
+Container_FindFlatHashSlot (unsigned int, struct container__flathash* restrict);
+
+extern void
+Container_PlaceFlatHashNode (
+                             unsigned int,
+                             unsigned int,
+                             struct container__flathash_node* restrict,
+                             struct container__flathash* restrict
+                            );
+
+extern enum container__error_code
+Container_AllocFlatHash (unsigned int, struct container__flathash* restrict);
+
+extern enum container__error_code
+Container_RehashFlatHash (struct container__flathash* restrict);
+
+extern void
+Container_UpdateFlatHashScan (
+                              struct container__flathash* restrict,
+                              struct container__flathash_scan* restrict
+                             );
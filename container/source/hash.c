@@ -8,15 +8,141 @@ Container_InitHash (
                     struct container__hash* restrict
                    );
 
+extern void
+Container_InitHashParallel (
+                            unsigned int,
+                            struct container__hash_bucket* restrict,
+                            const struct container__hash_parallel*,
+                            struct container__hash* restrict
+                           );
+
+extern void
+Container_InitHashShift (
+                         unsigned int,
+                         struct container__hash_bucket* restrict,
+                         struct container__hash* restrict
+                        );
+
 extern enum container__error_code
 Container_CreateHash (unsigned int, struct container__hash* restrict);
 
+extern enum container__error_code
+Container_CreateHashShift (unsigned int, struct container__hash* restrict);
+
+extern enum container__error_code
+Container_CreateHashAlloc (
+                           unsigned int,
+                           enum container__hash_alloc_type,
+                           struct container__hash* restrict
+                          );
+
+extern enum container__error_code
+Container_CreateHashShiftAlloc (
+                                unsigned int,
+                                enum container__hash_alloc_type,
+                                struct container__hash* restrict
+                               );
+
+extern enum container__error_code
+Container_CreateHashWithAllocator (
+                                   unsigned int,
+                                   enum container__hash_alloc_type,
+                                   const struct container__allocator*,
+                                   struct container__hash* restrict
+                                  );
+
+extern enum container__error_code
+Container_CreateHashShiftWithAllocator (
+                                        unsigned int,
+                                        enum container__hash_alloc_type,
+                                        const struct container__allocator*,
+                                        struct container__hash* restrict
+                                       );
+
+extern enum container__error_code
+Container_CreateHashParallel (
+                              unsigned int,
+                              enum container__hash_alloc_type,
+                              const struct container__allocator*,
+                              const struct container__hash_parallel*,
+                              struct container__hash* restrict
+                             );
+
+extern enum container__error_code
+Container_CreateHashShiftParallel (
+                                   unsigned int,
+                                   enum container__hash_alloc_type,
+                                   const struct container__allocator*,
+                                   const struct container__hash_parallel*,
+                                   struct container__hash* restrict
+                                  );
+
 extern void
 Container_DestroyHash (struct container__hash* restrict);
 
 extern void
 Container_ResetHash (struct container__hash* restrict);
 
+extern void
+Container_ResetHashPart (unsigned int, unsigned int, struct container__hash* restrict);
+
+extern void
+Container_ResetHashParallel (
+                             const struct container__hash_parallel*,
+                             struct container__hash* restrict
+                            );
+
+
+extern enum container__error_code
+Container_CreateHashOccupancy (struct container__hash* restrict);
+
+extern void
+Container_DestroyHashOccupancy (struct container__hash* restrict);
+
+
+extern void
+Container_RehashHash (
+                      struct container__hash* restrict,
+                      struct container__hash* restrict,
+                      container__hash_value_type,
+                      void*
+                     );
+
+extern enum container__error_code
+Container_ResizeHash (
+                      unsigned int,
+                      struct container__hash* restrict,
+                      container__hash_value_type,
+                      void*
+                     );
+
+extern void
+Container_MergeHash (
+                     struct container__hash* restrict,
+                     struct container__hash* restrict,
+                     container__hash_value_type,
+                     void*
+                    );
+
+extern void
+Container_MergeHashBucket (
+                           struct container__hash_bucket* restrict,
+                           struct container__hash_bucket* restrict
+                          );
+
+
+extern void
+Container_SetHashCounters (
+                           struct container__hash_counters* restrict,
+                           struct container__hash* restrict
+                          );
+
+extern void
+Container_HashStats (
+                     struct container__hash* restrict,
+                     struct container__hash_stats* restrict
+                    );
+
 
 extern struct container__hash_bucket*
 Container_LookupHashBucket (
@@ -34,6 +160,49 @@ Container_LookupHashNode (
                           struct container__hash_bucket** restrict
                          );
 
+extern struct container__hash_node*
+Container_LookupHashNodeMoveFront (
+                                   unsigned int,
+                                   void*,
+                                   struct container__hash* restrict,
+                                   container__hash_lookup_type,
+                                   void*,
+                                   struct container__hash_bucket** restrict
+                                  );
+
+extern struct container__hash_node*
+Container_LookupHashNodeTranspose (
+                                   unsigned int,
+                                   void*,
+                                   struct container__hash* restrict,
+                                   container__hash_lookup_type,
+                                   void*,
+                                   struct container__hash_bucket** restrict
+                                  );
+
+
+extern struct container__hash_node*
+Container_LookupCachedHashNode (
+                                unsigned int,
+                                void*,
+                                struct container__hash* restrict,
+                                container__hash_lookup_type,
+                                void*,
+                                struct container__hash_bucket** restrict
+                               );
+
+
+extern void
+Container_LookupHashNodeBatch (
+                               unsigned int,
+                               const unsigned int* restrict,
+                               void* const* restrict,
+                               struct container__hash* restrict,
+                               container__hash_lookup_type,
+                               void*,
+                               struct container__hash_node** restrict
+                              );
+
 
 extern void
 Container_AddHashNode (
@@ -42,16 +211,44 @@ Container_AddHashNode (
                        struct container__hash* restrict
                       );
 
+extern void
+Container_AddGroupedHashNode (
+                              unsigned int,
+                              void*,
+                              struct container__hash_node* restrict,
+                              struct container__hash* restrict,
+                              container__hash_lookup_type,
+                              void*
+                             );
+
 extern void
 Container_InsHashNode (
                        struct container__hash_node* restrict,
                        struct container__hash_bucket* restrict
                       );
 
+extern void
+Container_AddCachedHashNode (
+                             unsigned int,
+                             struct container__cached_hash_node* restrict,
+                             struct container__hash* restrict
+                            );
+
+extern void
+Container_InsCachedHashNode (
+                             unsigned int,
+                             struct container__cached_hash_node* restrict,
+                             struct container__hash_bucket* restrict
+                            );
+
 extern void
 Container_RemoveHashNode (struct container__hash_node* restrict);
 
 
+extern unsigned int
+Container_CachedHashValue (struct container__hash_node* restrict, void*);
+
+
 extern enum container__hash_bucket_state
 Container_HashBucketState (struct container__hash_bucket* restrict);
 
@@ -72,6 +269,87 @@ extern enum container__hash_bucket_scan_state
 Container_HashBucketScanState (struct container__hash_bucket_scan* restrict);
 
 
+extern void
+Container_StartHashScan (
+                         struct container__hash* restrict,
+                         struct container__hash_scan* restrict
+                        );
+
+extern void
+Container_ResumeHashScan (
+                          struct container__hash* restrict,
+                          struct container__hash_scan* restrict
+                         );
+
+extern enum container__hash_scan_state
+Container_HashScanState (struct container__hash_scan* restrict);
+
+
+extern void
+Container_StartHashEqualScan (
+                              unsigned int,
+                              void*,
+                              struct container__hash* restrict,
+                              container__hash_lookup_type,
+                              void*,
+                              struct container__hash_equal_scan* restrict
+                             );
+
+extern void
+Container_ResumeHashEqualScan (
+                               struct container__hash* restrict,
+                               struct container__hash_equal_scan* restrict
+                              );
+
+extern enum container__hash_equal_scan_state
+Container_HashEqualScanState (struct container__hash_equal_scan* restrict);
+
+
+extern void
+Container_ResetHashTask (unsigned int, void*);
+
+extern unsigned int
+Container_HashBucketIndex (unsigned int, struct container__hash* restrict);
+
+extern void
+Container_CountHashLookup (
+                           unsigned int,
+                           struct container__hash_node* restrict,
+                           struct container__hash* restrict
+                          );
+
+extern struct container__hash_bucket*
+Container_MapHashBuckets (size_t, struct container__hash* restrict);
+
+extern struct container__hash_bucket*
+Container_AllocHashBuckets (
+                            unsigned int,
+                            enum container__hash_alloc_type,
+                            struct container__hash* restrict
+                           );
+
+extern unsigned int
+Container_HashOccupancyWords (unsigned int);
+
+extern unsigned int
+Container_LowestHashOccupancyBit (unsigned long long);
+
+extern void
+Container_MarkHashBucket (unsigned int, struct container__hash* restrict);
+
+extern unsigned int
+Container_FindHashBucket (unsigned int, struct container__hash* restrict);
+
+extern void
+Container_StartHashScanBucket (
+                               unsigned int,
+                               struct container__hash* restrict,
+                               struct container__hash_scan* restrict
+                              );
+
+extern unsigned int
+Container_UpdateHashEqualScan (struct container__hash_equal_scan* restrict);
+
 extern void
 Container_UpdateHashBucketScan (
                                 struct container__hash_bucket* restrict,
@@ -0,0 +1,39 @@
+#include <container/hashfn.h>
+
+
+extern unsigned int
+Container_HashInt (int);
+
+extern unsigned int
+Container_HashUInt (unsigned int);
+
+extern unsigned int
+Container_HashLong (long long);
+
+extern unsigned int
+Container_HashULong (unsigned long long);
+
+extern unsigned int
+Container_HashBytes (const void* restrict, size_t, unsigned int);
+
+extern unsigned int
+Container_HashString (const char* restrict, unsigned int);
+
+
+extern uint64_t
+Container_HashRotate (uint64_t, unsigned int);
+
+extern uint64_t
+Container_HashRead64 (const unsigned char* restrict);
+
+extern uint32_t
+Container_HashRead32 (const unsigned char* restrict);
+
+extern uint64_t
+Container_HashRound (uint64_t, uint64_t);
+
+extern uint64_t
+Container_HashMergeRound (uint64_t, uint64_t);
+
+extern uint64_t
+Container_HashAvalanche (uint64_t);
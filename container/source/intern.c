@@ -0,0 +1,46 @@
+#include <container/intern.h>
+
+
+extern enum container__error_code
+Container_CreateIntern (unsigned int, struct container__intern* restrict);
+
+extern enum container__error_code
+Container_CreateInternWithAllocator (
+                                     unsigned int,
+                                     const struct container__allocator*,
+                                     struct container__intern* restrict
+                                    );
+
+extern void
+Container_DestroyIntern (struct container__intern* restrict);
+
+
+extern enum container__error_code
+Container_InternString (
+                        const char*,
+                        size_t,
+                        const char** restrict,
+                        struct container__intern* restrict
+                       );
+
+extern const char*
+Container_FindInternString (const char*, size_t, struct container__intern* restrict);
+
+extern size_t
+Container_InternStringLength (const char*);
+
+extern unsigned int
+Container_InternStringHash (const char*);
+
+
+extern struct container__intern_string*
+Container_InternStringOf (const char*);
+
+extern enum container__hash_cmp_result
+Container_InternLookup (void*, struct container__hash_node* restrict, void*);
+
+extern struct container__intern_string*
+Container_AllocInternString (size_t, struct container__intern* restrict);
+
+extern void
+Container_GrowIntern (struct container__intern* restrict);
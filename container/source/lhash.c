@@ -0,0 +1,82 @@
+#include <container/lhash.h>
+
+
+extern enum container__error_code
+Container_CreateLHash (
+                       unsigned int,
+                       unsigned int,
+                       container__hash_value_type,
+                       void*,
+                       struct container__lhash* restrict
+                      );
+
+extern enum container__error_code
+Container_CreateLHashWithAllocator (
+                                    unsigned int,
+                                    unsigned int,
+                                    container__hash_value_type,
+                                    void*,
+                                    const struct container__allocator*,
+                                    struct container__lhash* restrict
+                                   );
+
+extern void
+Container_DestroyLHash (struct container__lhash* restrict);
+
+extern void
+Container_ResetLHash (struct container__lhash* restrict);
+
+
+extern unsigned int
+Container_LHashBucketCount (struct container__lhash* restrict);
+
+extern struct container__hash_bucket*
+Container_LHashBucket (unsigned int, struct container__lhash* restrict);
+
+
+extern struct container__hash_bucket*
+Container_LookupLHashBucket (unsigned int, struct container__lhash* restrict);
+
+extern struct container__hash_node*
+Container_LookupLHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__lhash* restrict,
+                           container__hash_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+
+extern void
+Container_AddLHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__lhash* restrict
+                       );
+
+extern void
+Container_InsLHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__lhash* restrict
+                       );
+
+extern void
+Container_RemoveLHashNode (
+                           struct container__hash_node* restrict,
+                           struct container__lhash* restrict
+                          );
+
+
+extern unsigned int
+Container_LHashBucketIndex (unsigned int, struct container__lhash* restrict);
+
+extern enum container__error_code
+Container_AllocLHashSegment (unsigned int, struct container__lhash* restrict);
+
+extern void
+Container_SplitLHashBucket (struct container__lhash* restrict);
+
+extern void
+Container_MergeLHashBucket (struct container__lhash* restrict);
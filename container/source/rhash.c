@@ -0,0 +1,28 @@
+#include <container/rhash.h>
+
+
+extern struct container__hash_node*
+Container_LookupRHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__hash* restrict,
+                           container__hash_lookup_type,
+                           void*
+                          );
+
+
+extern void
+Container_AddRHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__hash* restrict
+                       );
+
+extern void
+Container_InsRHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict
+                       );
+
+extern void
+Container_RemoveRHashNode (struct container__hash_node* restrict);
@@ -0,0 +1,128 @@
+#include <container/shash.h>
+
+
+extern void
+Container_InitSHash (
+                     unsigned int,
+                     struct container__hash_bucket* restrict,
+                     unsigned int,
+                     size_t,
+                     void*,
+                     container__lock_sync_type,
+                     container__unlock_sync_type,
+                     struct container__shash* restrict
+                    );
+
+extern enum container__error_code
+Container_CreateSHash (
+                       unsigned int,
+                       unsigned int,
+                       size_t,
+                       void*,
+                       container__lock_sync_type,
+                       container__unlock_sync_type,
+                       struct container__shash* restrict
+                      );
+
+extern enum container__error_code
+Container_CreateSHashShift (
+                            unsigned int,
+                            unsigned int,
+                            size_t,
+                            void*,
+                            container__lock_sync_type,
+                            container__unlock_sync_type,
+                            struct container__shash* restrict
+                           );
+
+extern enum container__error_code
+Container_CreateSHashWithAllocator (
+                                    unsigned int,
+                                    unsigned int,
+                                    size_t,
+                                    void*,
+                                    container__lock_sync_type,
+                                    container__unlock_sync_type,
+                                    const struct container__allocator*,
+                                    struct container__shash* restrict
+                                   );
+
+extern enum container__error_code
+Container_CreateSHashShiftWithAllocator (
+                                         unsigned int,
+                                         unsigned int,
+                                         size_t,
+                                         void*,
+                                         container__lock_sync_type,
+                                         container__unlock_sync_type,
+                                         const struct container__allocator*,
+                                         struct container__shash* restrict
+                                        );
+
+extern void
+Container_DestroySHash (struct container__shash* restrict);
+
+
+extern void*
+Container_SHashStripe (
+                       struct container__hash_bucket* restrict,
+                       struct container__shash* restrict
+                      );
+
+extern void
+Container_LockSHashBucket (
+                           struct container__hash_bucket* restrict,
+                           struct container__shash* restrict
+                          );
+
+extern void
+Container_UnlockSHashBucket (
+                             struct container__hash_bucket* restrict,
+                             struct container__shash* restrict
+                            );
+
+
+extern struct container__hash_bucket*
+Container_LookupSHashBucket (unsigned int, struct container__shash* restrict);
+
+extern struct container__hash_node*
+Container_LookupSHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__shash* restrict,
+                           container__hash_lookup_type,
+                           void*,
+                           struct container__hash_bucket** restrict
+                          );
+
+
+extern void
+Container_AddSHashNode (
+                        unsigned int,
+                        struct container__hash_node* restrict,
+                        struct container__shash* restrict
+                       );
+
+extern void
+Container_InsSHashNode (
+                        struct container__hash_node* restrict,
+                        struct container__hash_bucket* restrict
+                       );
+
+extern void
+Container_RemoveSHashNode (
+                           unsigned int,
+                           struct container__hash_node* restrict,
+                           struct container__shash* restrict
+                          );
+
+
+extern void
+Container_InitSHashStripes (
+                            unsigned int,
+                            size_t,
+                            void*,
+                            container__lock_sync_type,
+                            container__unlock_sync_type,
+                            struct container__shash* restrict
+                           );
@@ -104,6 +104,9 @@ Container_InsULongHash (
 extern enum container__hash_cmp_result
 Container_StringHashTest (char*, char*);
 
+extern unsigned int
+Container_StringHashKeyValue (char*);
+
 extern enum container__hash_cmp_result
 Container_StringHashLookup (
                             void*,
@@ -125,3 +128,203 @@ Container_InsStringHash (
                          struct container__string_hash_node* restrict,
                          struct container__hash_bucket* restrict
                         );
+
+extern void
+Container_InitStringKey (const char*, size_t, struct container__string_key* restrict);
+
+extern enum container__hash_cmp_result
+Container_StringKeyHashTest (struct container__string_key, struct container__string_key);
+
+extern unsigned int
+Container_StringKeyHashKeyValue (struct container__string_key);
+
+extern enum container__hash_cmp_result
+Container_StringKeyHashLookup (
+                               void*,
+                               struct container__hash_node* restrict,
+                               void*
+                              );
+
+extern void
+Container_AddStringKeyHash (
+                            struct container__string_key,
+                            struct container__string_key_hash_node* restrict,
+                            struct container__hash* restrict
+                           );
+
+extern void
+Container_InsStringKeyHash (
+                            struct container__string_key,
+                            struct container__string_key_hash_node* restrict,
+                            struct container__hash_bucket* restrict
+                           );
+
+extern const char*
+Container_InlineStringHashValue (struct container__inline_string_hash_node* restrict);
+
+extern enum container__hash_cmp_result
+Container_InlineStringHashTest (
+                                const struct container__string_key* restrict,
+                                struct container__inline_string_hash_node* restrict
+                               );
+
+extern enum container__hash_cmp_result
+Container_InlineStringHashLookup (
+                                  void*,
+                                  struct container__hash_node* restrict,
+                                  void*
+                                 );
+
+extern void
+Container_AddInlineStringHash (
+                               const struct container__string_key* restrict,
+                               struct container__inline_string_hash_node* restrict,
+                               struct container__hash* restrict
+                              );
+
+extern void
+Container_InsInlineStringHash (
+                               const struct container__string_key* restrict,
+                               struct container__inline_string_hash_node* restrict,
+                               struct container__hash_bucket* restrict
+                              );
+
+extern enum container__hash_cmp_result
+Container_Blob16HashTest (struct container__blob16, struct container__blob16);
+
+extern enum container__hash_cmp_result
+Container_Blob16HashLookup (
+                            void*,
+                            struct container__hash_node* restrict,
+                            void*
+                           );
+
+extern void
+Container_AddBlob16Hash (
+                         struct container__blob16,
+                         unsigned int,
+                         struct container__blob16_hash_node* restrict,
+                         struct container__hash* restrict
+                        );
+
+extern void
+Container_InsBlob16Hash (
+                         struct container__blob16,
+                         struct container__blob16_hash_node* restrict,
+                         struct container__hash_bucket* restrict
+                        );
+
+extern enum container__hash_cmp_result
+Container_Blob32HashTest (struct container__blob32, struct container__blob32);
+
+extern enum container__hash_cmp_result
+Container_Blob32HashLookup (
+                            void*,
+                            struct container__hash_node* restrict,
+                            void*
+                           );
+
+extern void
+Container_AddBlob32Hash (
+                         struct container__blob32,
+                         unsigned int,
+                         struct container__blob32_hash_node* restrict,
+                         struct container__hash* restrict
+                        );
+
+extern void
+Container_InsBlob32Hash (
+                         struct container__blob32,
+                         struct container__blob32_hash_node* restrict,
+                         struct container__hash_bucket* restrict
+                        );
+
+extern enum container__hash_cmp_result
+Container_BlobHashTest (struct container__blob, struct container__blob);
+
+extern unsigned int
+Container_BlobHashKeyValue (struct container__blob);
+
+extern enum container__hash_cmp_result
+Container_BlobHashLookup (
+                          void*,
+                          struct container__hash_node* restrict,
+                          void*
+                         );
+
+extern void
+Container_AddBlobHash (
+                       struct container__blob,
+                       struct container__blob_hash_node* restrict,
+                       struct container__hash* restrict
+                      );
+
+extern void
+Container_InsBlobHash (
+                       struct container__blob,
+                       struct container__blob_hash_node* restrict,
+                       struct container__hash_bucket* restrict
+                      );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               IntHashKey,
+                               struct container__int_hash_node,
+                               int
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               UIntHashKey,
+                               struct container__uint_hash_node,
+                               unsigned int
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               LongHashKey,
+                               struct container__long_hash_node,
+                               long long
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               ULongHashKey,
+                               struct container__ulong_hash_node,
+                               unsigned long long
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               StringHashKey,
+                               struct container__string_hash_node,
+                               char*
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               StringKeyHashKey,
+                               struct container__string_key_hash_node,
+                               struct container__string_key
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               Blob16HashKey,
+                               struct container__blob16_hash_node,
+                               struct container__blob16
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               Blob32HashKey,
+                               struct container__blob32_hash_node,
+                               struct container__blob32
+                              );
+
+CONTAINER__DECLARE_EXTERN_HASH(
+                               Container_,
+                               BlobHashKey,
+                               struct container__blob_hash_node,
+                               struct container__blob
+                              );
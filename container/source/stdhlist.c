@@ -1,17 +1,17 @@
 #include <container/stdhlist.h>
 
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_IntHListTest (int, int);
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_IntHListLookup (
                           void*,
                           struct container__hlist_node* restrict,
                           void*
                          );
 
-inline void
+extern void
 Container_AddIntHList (
                        int,
                        unsigned int,
@@ -22,7 +22,7 @@ Container_AddIntHList (
                        struct container__hlist* restrict
                       );
 
-inline void
+extern void
 Container_InsIntHList (
                        int,
                        struct container__int_hlist_node* restrict,
@@ -30,17 +30,17 @@ Container_InsIntHList (
                        struct container__hlist* restrict
                       );
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_UIntHListTest (unsigned int, unsigned int);
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_UIntHListLookup (
                            void*,
                            struct container__hlist_node* restrict,
                            void*
                           );
 
-inline void
+extern void
 Container_AddUIntHList (
                         unsigned int,
                         unsigned int,
@@ -51,7 +51,7 @@ Container_AddUIntHList (
                         struct container__hlist* restrict
                        );
 
-inline void
+extern void
 Container_InsUIntHList (
                         unsigned int,
                         struct container__uint_hlist_node* restrict,
@@ -60,17 +60,17 @@ Container_InsUIntHList (
                        );
 
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_LongHListTest (long long, long long);
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_LongHListLookup (
                            void*,
                            struct container__hlist_node* restrict,
                            void*
                           );
 
-inline void
+extern void
 Container_AddLongHList (
                         long long,
                         unsigned int,
@@ -81,7 +81,7 @@ Container_AddLongHList (
                         struct container__hlist* restrict
                        );
 
-inline void
+extern void
 Container_InsLongHList (
                         long long,
                         struct container__long_hlist_node* restrict,
@@ -89,17 +89,17 @@ Container_InsLongHList (
                         struct container__hlist* restrict
                        );
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_ULongHListTest (unsigned long long, unsigned long long);
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_ULongHListLookup (
                             void*,
                             struct container__hlist_node* restrict,
                             void*
                            );
 
-inline void
+extern void
 Container_AddULongHList (
                         unsigned long long,
                         unsigned int,
@@ -110,7 +110,7 @@ Container_AddULongHList (
                         struct container__hlist* restrict
                        );
 
-inline void
+extern void
 Container_InsULongHList (
                          unsigned long long,
                          struct container__ulong_hlist_node* restrict,
@@ -119,17 +119,17 @@ Container_InsULongHList (
                         );
 
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_StringHListTest (char*, char*);
 
-inline enum container__hlist_cmp_result
+extern enum container__hlist_cmp_result
 Container_StringHListLookup (
                              void*,
                              struct container__hlist_node* restrict,
                              void*
                             );
 
-inline void
+extern void
 Container_AddStringHList (
                           char*,
                           unsigned int,
@@ -140,10 +140,97 @@ Container_AddStringHList (
                           struct container__hlist* restrict
                          );
 
-inline void
+extern void
 Container_InsStringHList (
                           char*,
                           struct container__string_hlist_node* restrict,
                           struct container__hash_bucket* restrict,
                           struct container__hlist* restrict
                          );
+
+
+extern enum container__hlist_cmp_result
+Container_Blob16HListTest (struct container__blob16, struct container__blob16);
+
+extern enum container__hlist_cmp_result
+Container_Blob16HListLookup (
+                             void*,
+                             struct container__hlist_node* restrict,
+                             void*
+                            );
+
+extern void
+Container_AddBlob16HList (
+                          struct container__blob16,
+                          unsigned int,
+                          struct container__blob16_hlist_node* restrict,
+                          void*,
+                          container__lock_sync_type,
+                          container__unlock_sync_type,
+                          struct container__hlist* restrict
+                         );
+
+extern void
+Container_InsBlob16HList (
+                          struct container__blob16,
+                          struct container__blob16_hlist_node* restrict,
+                          struct container__hash_bucket* restrict,
+                          struct container__hlist* restrict
+                         );
+
+extern enum container__hlist_cmp_result
+Container_Blob32HListTest (struct container__blob32, struct container__blob32);
+
+extern enum container__hlist_cmp_result
+Container_Blob32HListLookup (
+                             void*,
+                             struct container__hlist_node* restrict,
+                             void*
+                            );
+
+extern void
+Container_AddBlob32HList (
+                          struct container__blob32,
+                          unsigned int,
+                          struct container__blob32_hlist_node* restrict,
+                          void*,
+                          container__lock_sync_type,
+                          container__unlock_sync_type,
+                          struct container__hlist* restrict
+                         );
+
+extern void
+Container_InsBlob32HList (
+                          struct container__blob32,
+                          struct container__blob32_hlist_node* restrict,
+                          struct container__hash_bucket* restrict,
+                          struct container__hlist* restrict
+                         );
+
+extern enum container__hlist_cmp_result
+Container_BlobHListTest (struct container__blob, struct container__blob);
+
+extern enum container__hlist_cmp_result
+Container_BlobHListLookup (
+                           void*,
+                           struct container__hlist_node* restrict,
+                           void*
+                          );
+
+extern void
+Container_AddBlobHList (
+                        struct container__blob,
+                        struct container__blob_hlist_node* restrict,
+                        void*,
+                        container__lock_sync_type,
+                        container__unlock_sync_type,
+                        struct container__hlist* restrict
+                       );
+
+extern void
+Container_InsBlobHList (
+                        struct container__blob,
+                        struct container__blob_hlist_node* restrict,
+                        struct container__hash_bucket* restrict,
+                        struct container__hlist* restrict
+                       );
@@ -0,0 +1,86 @@
+#include <container/thash.h>
+
+
+extern void
+Container_InitTHash (
+                     unsigned int,
+                     struct container__thash_bucket* restrict,
+                     unsigned int,
+                     struct container__thash* restrict
+                    );
+
+extern enum container__error_code
+Container_CreateTHash (unsigned int, struct container__thash* restrict);
+
+extern enum container__error_code
+Container_CreateTHashWithAllocator (
+                                    unsigned int,
+                                    const struct container__allocator*,
+                                    struct container__thash* restrict
+                                   );
+
+extern void
+Container_DestroyTHash (struct container__thash* restrict);
+
+
+extern unsigned int
+Container_THashSeed (struct container__thash* restrict);
+
+
+extern struct container__thash_node*
+Container_LookupTHashNode (
+                           unsigned int,
+                           void*,
+                           struct container__thash* restrict,
+                           container__thash_lookup_type,
+                           void*
+                          );
+
+
+extern void
+Container_AddTHashNode (
+                        unsigned int,
+                        struct container__thash_node* restrict,
+                        struct container__thash* restrict
+                       );
+
+extern void
+Container_RemoveTHashNode (
+                           struct container__thash_node* restrict,
+                           struct container__thash* restrict
+                          );
+
+
+extern unsigned int
+Container_RandomTHashSeed (struct container__thash* restrict);
+
+extern unsigned int
+Container_SeedTHashValue (unsigned int, struct container__thash* restrict);
+
+extern struct container__thash_bucket*
+Container_THashBucket (unsigned int, struct container__thash* restrict);
+
+extern enum container__bst_cmp_result
+Container_THashTreeLookup (void*, struct container__bst_node* restrict, void*);
+
+extern enum container__bst_cmp_result
+Container_THashTreeCmp (
+                        struct container__bst_node* restrict,
+                        struct container__bst_node* restrict,
+                        void*
+                       );
+
+extern void
+Container_GrowTHashTree (struct container__thash_bucket* restrict);
+
+extern void
+Container_ShrinkTHashTree (struct container__thash_bucket* restrict);
+
+extern struct container__thash_node*
+Container_LookupTHashTree (
+                           unsigned int,
+                           void*,
+                           struct container__thash_bucket* restrict,
+                           container__thash_lookup_type,
+                           void*
+                          );
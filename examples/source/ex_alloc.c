@@ -0,0 +1,171 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <container/utils.h>
+#include <container/alloc.h>
+#include <container/lhash.h>
+
+
+#define ENTRY_COUNT 10000
+#define ARENA_SIZE  (1024*1024)
+
+
+/* The type we'll be adding to the lhash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+};
+
+/* A simple bump allocator, releasing nothing until the whole arena is discarded */
+struct my_arena
+{
+    unsigned char* memory;
+    size_t         used;
+    size_t         allocated;
+    size_t         released;
+};
+
+
+static inline unsigned int
+KeyHashValue (unsigned int);
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict, void*);
+
+static void*
+MyArenaAlloc (size_t, size_t, void*);
+
+static void
+MyArenaFree (void*, size_t, void*);
+
+
+static inline unsigned int
+KeyHashValue (unsigned int key)
+{
+    return key*2654435761u;
+}
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(node, struct my_data_entry, node);
+
+    return KeyHashValue(entry->my_key);
+}
+
+static void*
+MyArenaAlloc (size_t size, size_t alignment, void* user_data)
+{
+    struct my_arena* arena;
+    uintptr_t        address;
+
+    arena   = user_data;
+    address = (uintptr_t)(arena->memory+arena->used);
+    address = (address+alignment-1)&~(uintptr_t)(alignment-1);
+
+    if(address+size > (uintptr_t)(arena->memory+ARENA_SIZE))
+        return NULL;
+
+    arena->used       = address+size-(uintptr_t)arena->memory;
+    arena->allocated += size;
+
+    return (void*)address;
+}
+
+static void
+MyArenaFree (void* memory, size_t size, void* user_data)
+{
+    struct my_arena* arena;
+
+    arena = user_data;
+
+    arena->released += size;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*       entries;
+    struct my_arena             arena;
+    struct container__allocator my_allocator;
+    struct container__lhash     my_lhash;
+    enum container__error_code  lhash_error;
+
+    entries      = malloc(sizeof(*entries)*ENTRY_COUNT);
+    arena.memory = malloc(ARENA_SIZE);
+    if(entries == NULL || arena.memory == NULL)
+        return EXIT_FAILURE;
+
+    arena.used      = 0;
+    arena.allocated = 0;
+    arena.released  = 0;
+
+    my_allocator.alloc     = &MyArenaAlloc;
+    my_allocator.free      = &MyArenaFree;
+    my_allocator.user_data = &arena;
+    my_allocator.alignment = 64;
+
+    lhash_error = Container_CreateLHashWithAllocator(
+                                                     4,
+                                                     2,
+                                                     &MyHashValue,
+                                                     NULL,
+                                                     &my_allocator,
+                                                     &my_lhash
+                                                    );
+    if(lhash_error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+    {
+        entries[index].my_key   = index;
+        entries[index].my_value = index*3;
+
+        Container_AddLHashNode(KeyHashValue(index), &entries[index].node, &my_lhash);
+    }
+
+    printf("Added %u nodes, bucket count grew to: %u\n",
+           my_lhash.node_count,
+           Container_LHashBucketCount(&my_lhash));
+    printf("Arena bytes allocated: %lu, in use: %lu\n",
+           (unsigned long)arena.allocated,
+           (unsigned long)(arena.allocated-arena.released));
+
+    Container_DestroyLHash(&my_lhash);
+
+    printf("Arena bytes in use after destroy: %lu\n",
+           (unsigned long)(arena.allocated-arena.released));
+
+    free(arena.memory);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
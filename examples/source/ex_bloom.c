@@ -0,0 +1,156 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hashfn.h>
+#include <container/hash.h>
+#include <container/bloom.h>
+
+
+#define ENTRY_COUNT 1000
+
+
+/* The type we'll be adding to the hash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+};
+
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict, void*);
+
+static enum container__hash_cmp_result
+MyHashLookup (void*, struct container__hash_node* restrict, void*);
+
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(node, struct my_data_entry, node);
+
+    return Container_HashUInt(entry->my_key);
+}
+
+static enum container__hash_cmp_result
+MyHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->my_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*          entries;
+    struct container__hash         my_hash;
+    struct container__bloom        my_bloom;
+    struct container__bloom_stats  my_stats;
+    struct container__hash_bucket* searched_bucket;
+    enum container__error_code     error;
+    unsigned int                   found_count;
+
+    entries = malloc(sizeof(*entries)*ENTRY_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    error = Container_CreateHash(ENTRY_COUNT, &my_hash);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    error = Container_CreateBloom(ENTRY_COUNT, 10, &my_bloom);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    /* Add the even keys, so that lookups for the odd keys miss */
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+    {
+        entries[index].my_key   = index*2;
+        entries[index].my_value = index;
+
+        Container_AddBloomHashNode(
+                                   Container_HashUInt(entries[index].my_key),
+                                   &entries[index].node,
+                                   &my_bloom,
+                                   &my_hash
+                                  );
+    }
+
+    found_count = 0;
+    for(unsigned int lookup_key = 0; lookup_key < ENTRY_COUNT*2; lookup_key++)
+    {
+        if(Container_LookupBloomHashNode(
+                                         Container_HashUInt(lookup_key),
+                                         &lookup_key,
+                                         &my_bloom,
+                                         &my_hash,
+                                         &MyHashLookup,
+                                         NULL,
+                                         &searched_bucket
+                                        ) != NULL)
+        {
+            found_count++;
+        }
+    }
+
+    printf("Found %u of %u keys, %lu lookups turned away by the filter, %lu false positives\n",
+           found_count,
+           ENTRY_COUNT*2,
+           my_bloom.rejected_count,
+           my_bloom.false_positive_count);
+
+    /* Removed keys leave their bits set until the filter is rebuilt */
+    for(unsigned int index = 0; index < ENTRY_COUNT; index += 2)
+        Container_RemoveBloomHashNode(&entries[index].node, &my_bloom);
+
+    Container_BloomStats(&my_bloom, &my_stats);
+
+    printf("Stale ratio: %.2f, estimated false positive rate: %.4f\n",
+           my_stats.stale_ratio,
+           my_stats.estimated_false_positive_rate);
+
+    Container_RebuildHashBloom(&my_hash, &MyHashValue, NULL, &my_bloom);
+    Container_BloomStats(&my_bloom, &my_stats);
+
+    printf("After rebuilding, estimated false positive rate: %.4f\n",
+           my_stats.estimated_false_positive_rate);
+
+    Container_DestroyBloom(&my_bloom);
+    Container_DestroyHash(&my_hash);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
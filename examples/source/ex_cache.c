@@ -0,0 +1,116 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hashfn.h>
+#include <container/cache.h>
+
+
+struct my_element
+{
+    unsigned int                 my_key;
+    unsigned int                 my_value;
+    struct container__cache_node cache_node;
+};
+
+
+static enum container__cache_cmp_result
+MyLookup (void* lookup_value, struct container__cache_node* restrict node, void* user_data)
+{
+    struct my_element* element;
+
+    element = CONTAINER__CONTAINER_OF(node, struct my_element, cache_node);
+    if(element->my_key != *(unsigned int*)lookup_value)
+        return container__cache_node_not_equal;
+
+    return container__cache_node_equal;
+}
+
+static void
+MyEvict (struct container__cache_node* restrict node, void* user_data)
+{
+    struct my_element* element;
+
+    element = CONTAINER__CONTAINER_OF(node, struct my_element, cache_node);
+
+    printf("Evicting key %u\n", element->my_key);
+
+    free(element);
+}
+
+/* Return the square of a key, computing it only when the cache doesn't hold it */
+static unsigned int
+MySquare (unsigned int key, struct container__cache* my_cache)
+{
+    struct container__hash_bucket* searched_bucket;
+    struct container__cache_node*  found_node;
+    struct my_element*             element;
+
+    found_node = Container_LookupCacheNode(
+                                           Container_HashUInt(key),
+                                           &key,
+                                           my_cache,
+                                           &MyLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+    if(found_node != NULL)
+    {
+        element = CONTAINER__CONTAINER_OF(found_node, struct my_element, cache_node);
+
+        return element->my_value;
+    }
+
+    element = malloc(sizeof(*element));
+    if(element == NULL)
+        exit(EXIT_FAILURE);
+
+    element->my_key   = key;
+    element->my_value = key*key;
+
+    Container_InsCacheNode(1, &element->cache_node, searched_bucket, my_cache);
+
+    return element->my_value;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__cache    my_cache;
+    enum container__error_code error;
+    unsigned int               keys[] = {1, 2, 3, 1, 4, 1, 5, 2};
+    unsigned int               index;
+
+    /* Hold at most three nodes, evicting the least recently used */
+    error = Container_CreateCache(4, container__cache_lru, 3, 0, &MyEvict, NULL, &my_cache);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(index = 0; index < sizeof(keys)/sizeof(keys[0]); index++)
+        printf("Square of %u is %u\n", keys[index], MySquare(keys[index], &my_cache));
+
+    printf("%llu hits, %llu misses\n", my_cache.hit_count, my_cache.miss_count);
+
+    Container_DestroyCache(&my_cache);
+
+    return EXIT_SUCCESS;
+}
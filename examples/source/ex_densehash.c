@@ -0,0 +1,95 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/densehash.h>
+
+
+struct my_element
+{
+    unsigned int                           my_value;
+    struct container__dense_uint_hash_node node;
+};
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__dense_uint_hash       my_dense_hash;
+    struct container__dense_uint_hash_scan  scan;
+    struct container__dense_hash_probe      probe;
+    struct container__dense_uint_hash_node* found_node;
+    struct my_element                       my_elements[5];
+    enum container__error_code              error;
+    unsigned int                            index;
+
+    error = Container_CreateDenseUIntHash(4, &my_dense_hash);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(index = 0; index < 5; index++)
+    {
+        my_elements[index].my_value = index*index;
+
+        error = Container_AddDenseUIntHash(index*10, &my_elements[index].node, &my_dense_hash);
+        if(error != container__error_none)
+            return EXIT_FAILURE;
+    }
+
+    /* A missing key leaves the probe at the slot the key would be inserted in */
+    found_node = Container_LookupDenseUIntHash(25, &my_dense_hash, &probe);
+    if(found_node == NULL)
+    {
+        struct my_element* element;
+
+        element = &my_elements[2];
+
+        Container_RemoveDenseUIntHash(&element->node, &my_dense_hash);
+
+        /* Removing a node moves other keys, so the key is looked up again before inserting */
+        found_node = Container_LookupDenseUIntHash(25, &my_dense_hash, &probe);
+        if(found_node == NULL)
+        {
+            error = Container_InsDenseUIntHash(25, &element->node, &probe, &my_dense_hash);
+            if(error != container__error_none)
+                return EXIT_FAILURE;
+        }
+    }
+
+    for(
+        Container_StartDenseUIntHashScan(&my_dense_hash, &scan);
+        Container_DenseUIntHashScanState(&scan) != container__dense_hash_scan_finished;
+        Container_ResumeDenseUIntHashScan(&my_dense_hash, &scan)
+       )
+    {
+        struct my_element* element;
+
+        element = CONTAINER__CONTAINER_OF(scan.current_node, struct my_element, node);
+
+        printf("Key %u holds %u\n", scan.current_node->value, element->my_value);
+    }
+
+    printf("%u nodes in %u slots\n", my_dense_hash.node_count, my_dense_hash.slot_mask+1);
+
+    Container_DestroyDenseUIntHash(&my_dense_hash);
+
+    return EXIT_SUCCESS;
+}
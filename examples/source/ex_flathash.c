@@ -0,0 +1,149 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/flathash.h>
+
+
+/* The type we'll be adding to the flathash */
+struct my_data_entry
+{
+    char* my_key;
+    int   my_value;
+
+    /* Stores flathash-specific node data */
+    struct container__flathash_node node;
+};
+
+
+static inline unsigned int
+KeyHashValue (char* restrict);
+
+static enum container__hash_cmp_result
+MyFlatHashLookup (void*, struct container__flathash_node* restrict, void*);
+
+
+static inline unsigned int
+KeyHashValue (char* restrict key)
+{
+    unsigned int value_hash;
+
+    value_hash = 2166136261u;
+    while(*key != '\0')
+        value_hash = (value_hash^(unsigned char)*key++)*16777619u;
+
+    return value_hash;
+}
+
+static enum container__hash_cmp_result
+MyFlatHashLookup (
+                  void*                                     lookup_key,
+                  struct container__flathash_node* restrict cmp_node,
+                  void*                                     user_data
+                 )
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(strcmp(lookup_key, entry->my_key) == 0)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry             entries[4];
+    struct container__flathash       my_flathash;
+    struct container__flathash_probe probe;
+    struct container__flathash_scan  scan;
+    struct container__flathash_node* found_node;
+    struct my_data_entry* restrict   entry;
+    enum container__error_code       flathash_error;
+
+    flathash_error = Container_CreateFlatHash(4, &my_flathash);
+    if(flathash_error != container__error_none)
+        return EXIT_FAILURE;
+
+    entries[0].my_key   = "sixteen";
+    entries[0].my_value = 16;
+
+    entries[1].my_key   = "control";
+    entries[1].my_value = 1;
+
+    entries[2].my_key   = "bytes";
+    entries[2].my_value = 8;
+
+    entries[3].my_key   = "per group";
+    entries[3].my_value = 128;
+
+    for(unsigned int index = 4; index-- > 0;)
+    {
+        found_node = Container_LookupFlatHashNode(
+                                                  KeyHashValue(entries[index].my_key),
+                                                  entries[index].my_key,
+                                                  &my_flathash,
+                                                  &MyFlatHashLookup,
+                                                  NULL,
+                                                  &probe
+                                                 );
+        if(found_node != NULL)
+            continue;
+
+        flathash_error = Container_InsFlatHashNode(&entries[index].node, &probe, &my_flathash);
+        if(flathash_error != container__error_none)
+            return EXIT_FAILURE;
+    }
+
+    for(
+        Container_StartFlatHashScan(&my_flathash, &scan);
+        Container_FlatHashScanState(&scan) != container__flathash_scan_finished;
+        Container_ResumeFlatHashScan(&my_flathash, &scan)
+       )
+    {
+        entry = CONTAINER__CONTAINER_OF(scan.current_node, struct my_data_entry, node);
+
+        printf("Scanning key: '%s' value: %d\n", entry->my_key, entry->my_value);
+    }
+
+    found_node = Container_LookupFlatHashNode(
+                                              KeyHashValue("bytes"),
+                                              "bytes",
+                                              &my_flathash,
+                                              &MyFlatHashLookup,
+                                              NULL,
+                                              &probe
+                                             );
+
+    entry = CONTAINER__CONTAINER_OF(found_node, struct my_data_entry, node);
+
+    printf("Found flathash node with key: '%s', value: %d\n", entry->my_key, entry->my_value);
+
+    Container_DestroyFlatHash(&my_flathash);
+
+    return EXIT_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include <string.h>
 #include <container/utils.h>
 #include <container/hash.h>
+#include <container/hashfn.h>
 
 
 #define HASH_BUCKET_COUNT 256
@@ -51,7 +52,7 @@ MyHashLookup (void*, struct container__hash_node* restrict, void*);
 static inline unsigned int
 KeyHashValue (char* restrict key)
 {
-    return key[0];
+    return Container_HashString(key, CONTAINER__HASHFN_DEFAULT_SEED);
 }
 
 static enum container__hash_cmp_result
@@ -70,15 +71,20 @@ MyHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node,
 
 int main (int argument_count, char** arguments)
 {
-    struct my_data_entry           entries[4];
-    struct container__hash_bucket  hash_buckets[HASH_BUCKET_COUNT];
-    struct container__hash         my_hash;
-    struct container__hash_bucket* searched_bucket;
-    struct container__hash_node*   found_node;
-    struct my_data_entry* restrict found_entry;
+    struct my_data_entry            entries[4];
+    struct container__hash_bucket   hash_buckets[HASH_BUCKET_COUNT];
+    struct container__hash          my_hash;
+    struct container__hash_bucket*  searched_bucket;
+    struct container__hash_node*    found_node;
+    struct my_data_entry* restrict  found_entry;
+    struct container__hash_counters my_counters;
+    struct container__hash_stats    my_stats;
 
     Container_InitHash(HASH_BUCKET_COUNT, hash_buckets, &my_hash);
 
+    /* Count the lookups made from here on */
+    Container_SetHashCounters(&my_counters, &my_hash);
+
     entries[0].my_key   = "c";
     entries[0].my_value = 1337;
 
@@ -107,5 +113,19 @@ int main (int argument_count, char** arguments)
 
     printf("Found hash node with key: '%s', value: %d\n", found_entry->my_key, found_entry->my_value);
 
+    Container_HashStats(&my_hash, &my_stats);
+
+    printf("%lu nodes in %u buckets, %u empty, longest chain: %u, mean chain: %.2f\n",
+           my_stats.node_count,
+           my_stats.bucket_count,
+           my_stats.empty_bucket_count,
+           my_stats.max_chain_length,
+           my_stats.mean_chain_length);
+
+    printf("%lu lookups, %lu found, %lu compares\n",
+           my_counters.lookup_count,
+           my_counters.found_count,
+           my_counters.compare_count);
+
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,78 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/intern.h>
+
+
+/* Identifiers as a tokenizer might see them, with many repeats */
+static const char* my_tokens[] = {
+                                  "count", "index", "value", "count", "node", "index",
+                                  "value", "count", "next", "node", "index", "prev"
+                                 };
+
+
+int main (int argument_count, char** arguments)
+{
+    struct container__intern   my_intern;
+    const char*                handles[sizeof(my_tokens)/sizeof(my_tokens[0])];
+    enum container__error_code error;
+    unsigned int               token_count;
+    unsigned int               index;
+
+    token_count = sizeof(my_tokens)/sizeof(my_tokens[0]);
+
+    error = Container_CreateIntern(64, &my_intern);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(index = 0; index < token_count; index++)
+    {
+        error = Container_InternString(
+                                       my_tokens[index],
+                                       strlen(my_tokens[index]),
+                                       &handles[index],
+                                       &my_intern
+                                      );
+        if(error != container__error_none)
+            return EXIT_FAILURE;
+    }
+
+    /* Handles of equal strings are equal pointers, so no string compare is needed */
+    for(index = 0; index < token_count; index++)
+    {
+        if(handles[index] == handles[0])
+            printf("Token %u is \"%s\"\n", index, handles[index]);
+    }
+
+    printf("%u tokens interned as %lu distinct strings in %lu chunks\n",
+           token_count,
+           (unsigned long)my_intern.string_count,
+           (unsigned long)my_intern.chunk_count);
+
+    if(Container_FindInternString("missing", 7, &my_intern) == NULL)
+        printf("\"missing\" was never interned\n");
+
+    Container_DestroyIntern(&my_intern);
+
+    return EXIT_SUCCESS;
+}
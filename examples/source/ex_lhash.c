@@ -0,0 +1,136 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/lhash.h>
+
+
+#define ENTRY_COUNT 10000
+
+
+/* The type we'll be adding to the lhash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+};
+
+
+static inline unsigned int
+KeyHashValue (unsigned int);
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict, void*);
+
+static enum container__hash_cmp_result
+MyHashLookup (void*, struct container__hash_node* restrict, void*);
+
+
+static inline unsigned int
+KeyHashValue (unsigned int key)
+{
+    return key*2654435761u;
+}
+
+static unsigned int
+MyHashValue (struct container__hash_node* restrict node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(node, struct my_data_entry, node);
+
+    return KeyHashValue(entry->my_key);
+}
+
+static enum container__hash_cmp_result
+MyHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->my_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*          entries;
+    struct container__lhash        my_lhash;
+    struct container__hash_bucket* searched_bucket;
+    struct container__hash_node*   found_node;
+    struct my_data_entry* restrict found_entry;
+    enum container__error_code     lhash_error;
+    unsigned int                   lookup_key;
+
+    entries = malloc(sizeof(*entries)*ENTRY_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    lhash_error = Container_CreateLHash(4, 2, &MyHashValue, NULL, &my_lhash);
+    if(lhash_error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+    {
+        entries[index].my_key   = index;
+        entries[index].my_value = index*3;
+
+        Container_AddLHashNode(KeyHashValue(index), &entries[index].node, &my_lhash);
+    }
+
+    printf("Added %u nodes, bucket count grew to: %u\n",
+           my_lhash.node_count,
+           Container_LHashBucketCount(&my_lhash));
+
+    lookup_key = 1337;
+    found_node = Container_LookupLHashNode(
+                                           KeyHashValue(lookup_key),
+                                           &lookup_key,
+                                           &my_lhash,
+                                           &MyHashLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+
+    found_entry = CONTAINER__CONTAINER_OF(found_node, struct my_data_entry, node);
+
+    printf("Found lhash node with key: %u, value: %d\n", found_entry->my_key, found_entry->my_value);
+
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+        Container_RemoveLHashNode(&entries[index].node, &my_lhash);
+
+    printf("Removed all nodes, bucket count shrank to: %u\n", Container_LHashBucketCount(&my_lhash));
+
+    Container_DestroyLHash(&my_lhash);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/hash.h>
+#include <container/hashfn.h>
+
+
+#define HASH_BUCKET_COUNT 64
+
+
+/* The type we'll be adding to the hash, keyed by a field which isn't unique */
+struct my_data_entry
+{
+    char* my_city;
+    char* my_name;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+};
+
+
+static inline unsigned int
+CityHashValue (char* restrict);
+
+static enum container__hash_cmp_result
+MyCityLookup (void*, struct container__hash_node* restrict, void*);
+
+
+static inline unsigned int
+CityHashValue (char* restrict city)
+{
+    return Container_HashString(city, CONTAINER__HASHFN_DEFAULT_SEED);
+}
+
+static enum container__hash_cmp_result
+MyCityLookup (void* lookup_city, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(strcmp(lookup_city, entry->my_city) == 0)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry              entries[5];
+    struct container__hash_bucket     hash_buckets[HASH_BUCKET_COUNT];
+    struct container__hash            my_hash;
+    struct container__hash_equal_scan equal_scan;
+
+    Container_InitHash(HASH_BUCKET_COUNT, hash_buckets, &my_hash);
+
+    entries[0].my_city = "boston";
+    entries[0].my_name = "ada";
+
+    entries[1].my_city = "chicago";
+    entries[1].my_name = "grace";
+
+    entries[2].my_city = "boston";
+    entries[2].my_name = "edsger";
+
+    entries[3].my_city = "denver";
+    entries[3].my_name = "barbara";
+
+    entries[4].my_city = "boston";
+    entries[4].my_name = "donald";
+
+    /* Entries sharing a city are kept next to each other within their bucket */
+    for(unsigned int index = 0; index < 5; index++)
+    {
+        Container_AddGroupedHashNode(
+                                     CityHashValue(entries[index].my_city),
+                                     entries[index].my_city,
+                                     &entries[index].node,
+                                     &my_hash,
+                                     &MyCityLookup,
+                                     NULL
+                                    );
+    }
+
+    for(
+        Container_StartHashEqualScan(
+                                     CityHashValue("boston"),
+                                     "boston",
+                                     &my_hash,
+                                     &MyCityLookup,
+                                     NULL,
+                                     &equal_scan
+                                    );
+        Container_HashEqualScanState(&equal_scan) != container__hash_equal_scan_finished;
+        Container_ResumeHashEqualScan(&my_hash, &equal_scan)
+       )
+    {
+        struct my_data_entry* restrict found_entry;
+
+        found_entry = CONTAINER__CONTAINER_OF(equal_scan.current_node, struct my_data_entry, node);
+
+        printf("Found '%s' in '%s'\n", found_entry->my_name, found_entry->my_city);
+    }
+
+    return EXIT_SUCCESS;
+}
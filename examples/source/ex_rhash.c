@@ -0,0 +1,224 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <container/utils.h>
+#include <container/epoch.h>
+#include <container/rhash.h>
+
+
+#define READER_COUNT 4
+#define KEY_COUNT    1000
+#define UPDATE_COUNT 100000
+
+
+/* The type we'll be adding to the hash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+
+    /* Stores the node data used to defer freeing the entry */
+    struct container__epoch_node epoch_node;
+};
+
+struct my_reader_data
+{
+    unsigned int             reader_index;
+    unsigned int             found_count;
+    struct container__hash*  hash;
+    struct container__epoch* epoch;
+};
+
+
+static int done;
+
+
+static inline unsigned int
+KeyHashValue (unsigned int);
+
+static enum container__hash_cmp_result
+MyHashLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+MyReclaim (struct container__epoch_node* restrict, void*);
+
+static void*
+MyReader (void*);
+
+
+static inline unsigned int
+KeyHashValue (unsigned int key)
+{
+    return key*2654435761u;
+}
+
+static enum container__hash_cmp_result
+MyHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->my_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+MyReclaim (struct container__epoch_node* restrict epoch_node, void* user_data)
+{
+    struct my_data_entry* entry;
+
+    entry = CONTAINER__CONTAINER_OF(epoch_node, struct my_data_entry, epoch_node);
+
+    free(entry);
+}
+
+static void*
+MyReader (void* argument)
+{
+    struct my_reader_data* reader_data;
+    unsigned int           key;
+
+    reader_data = argument;
+    key         = reader_data->reader_index;
+
+    while(!__atomic_load_n(&done, __ATOMIC_RELAXED))
+    {
+        struct container__hash_node* found_node;
+
+        key = (key+7)%KEY_COUNT;
+
+        Container_EnterEpoch(reader_data->reader_index, reader_data->epoch);
+
+        found_node = Container_LookupRHashNode(
+                                               KeyHashValue(key),
+                                               &key,
+                                               reader_data->hash,
+                                               &MyHashLookup,
+                                               NULL
+                                              );
+        if(found_node != NULL)
+        {
+            struct my_data_entry* entry;
+
+            /* The entry can't be freed until this reader exits the epoch */
+            entry = CONTAINER__CONTAINER_OF(found_node, struct my_data_entry, node);
+            if(entry->my_value == (int)entry->my_key*3)
+                reader_data->found_count++;
+        }
+
+        Container_ExitEpoch(reader_data->reader_index, reader_data->epoch);
+    }
+
+    return NULL;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*      entries[KEY_COUNT];
+    struct my_reader_data      reader_data[READER_COUNT];
+    pthread_t                  readers[READER_COUNT];
+    struct container__hash     my_hash;
+    struct container__epoch    my_epoch;
+    enum container__error_code error;
+
+    error = Container_CreateHashShift(10, &my_hash);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    error = Container_CreateEpoch(READER_COUNT, &MyReclaim, NULL, &my_epoch);
+    if(error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+    {
+        entries[index] = malloc(sizeof(*entries[index]));
+        if(entries[index] == NULL)
+            return EXIT_FAILURE;
+
+        entries[index]->my_key   = index;
+        entries[index]->my_value = index*3;
+
+        Container_AddRHashNode(KeyHashValue(index), &entries[index]->node, &my_hash);
+    }
+
+    for(unsigned int index = 0; index < READER_COUNT; index++)
+    {
+        reader_data[index].reader_index = index;
+        reader_data[index].found_count  = 0;
+        reader_data[index].hash         = &my_hash;
+        reader_data[index].epoch        = &my_epoch;
+
+        pthread_create(&readers[index], NULL, &MyReader, &reader_data[index]);
+    }
+
+    /* The single writer replaces entries while the readers look them up */
+    for(unsigned int update = 0; update < UPDATE_COUNT; update++)
+    {
+        struct my_data_entry* new_entry;
+        unsigned int          key;
+
+        key       = update%KEY_COUNT;
+        new_entry = malloc(sizeof(*new_entry));
+        if(new_entry == NULL)
+            return EXIT_FAILURE;
+
+        new_entry->my_key   = key;
+        new_entry->my_value = key*3;
+
+        Container_AddRHashNode(KeyHashValue(key), &new_entry->node, &my_hash);
+        Container_RemoveRHashNode(&entries[key]->node);
+        Container_RetireEpochNode(&entries[key]->epoch_node, &my_epoch);
+
+        entries[key] = new_entry;
+
+        if(update%64 == 0)
+            Container_ReclaimEpoch(&my_epoch);
+    }
+
+    __atomic_store_n(&done, 1, __ATOMIC_RELAXED);
+
+    for(unsigned int index = 0; index < READER_COUNT; index++)
+    {
+        pthread_join(readers[index], NULL);
+
+        printf("Reader %u found %u entries\n", index, reader_data[index].found_count);
+    }
+
+    Container_DestroyEpoch(&my_epoch);
+
+    for(unsigned int index = 0; index < KEY_COUNT; index++)
+        free(entries[index]);
+
+    Container_DestroyHash(&my_hash);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <container/utils.h>
+#include <container/shash.h>
+
+
+#define THREAD_COUNT       4
+#define ENTRIES_PER_THREAD 10000
+#define STRIPE_COUNT       16
+
+
+/* The type we'll be adding to the shash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores hash-specific node data */
+    struct container__hash_node node;
+};
+
+/* Each stripe is padded so that neighbouring stripes don't share a cache line */
+struct my_stripe
+{
+    pthread_mutex_t mutex;
+    char            padding[64];
+};
+
+struct my_thread_data
+{
+    unsigned int             first_key;
+    struct my_data_entry*    entries;
+    struct container__shash* shash;
+};
+
+
+static inline unsigned int
+KeyHashValue (unsigned int);
+
+static enum container__hash_cmp_result
+MyHashLookup (void*, struct container__hash_node* restrict, void*);
+
+static void
+MyLock (void*);
+
+static void
+MyUnlock (void*);
+
+static void*
+MyThread (void*);
+
+
+static inline unsigned int
+KeyHashValue (unsigned int key)
+{
+    return key*2654435761u;
+}
+
+static enum container__hash_cmp_result
+MyHashLookup (void* lookup_key, struct container__hash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->my_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+static void
+MyLock (void* stripe)
+{
+    pthread_mutex_lock(&((struct my_stripe*)stripe)->mutex);
+}
+
+static void
+MyUnlock (void* stripe)
+{
+    pthread_mutex_unlock(&((struct my_stripe*)stripe)->mutex);
+}
+
+static void*
+MyThread (void* argument)
+{
+    struct my_thread_data* thread_data;
+
+    thread_data = argument;
+
+    for(unsigned int index = 0; index < ENTRIES_PER_THREAD; index++)
+    {
+        struct my_data_entry*          entry;
+        struct container__hash_bucket* searched_bucket;
+        struct container__hash_node*   found_node;
+        unsigned int                   key;
+
+        entry = &thread_data->entries[index];
+        key   = thread_data->first_key+index;
+
+        /* The bucket is left locked, so checking for the key and inserting it is atomic */
+        found_node = Container_LookupSHashNode(
+                                               KeyHashValue(key),
+                                               &key,
+                                               thread_data->shash,
+                                               &MyHashLookup,
+                                               NULL,
+                                               &searched_bucket
+                                              );
+        if(found_node == NULL)
+        {
+            entry->my_key   = key;
+            entry->my_value = key*3;
+
+            Container_InsSHashNode(&entry->node, searched_bucket);
+        }
+
+        Container_UnlockSHashBucket(searched_bucket, thread_data->shash);
+    }
+
+    return NULL;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*          entries;
+    struct my_stripe               stripes[STRIPE_COUNT];
+    struct my_thread_data          thread_data[THREAD_COUNT];
+    pthread_t                      threads[THREAD_COUNT];
+    struct container__shash        my_shash;
+    struct container__hash_bucket* searched_bucket;
+    struct container__hash_node*   found_node;
+    struct my_data_entry*          found_entry;
+    enum container__error_code     shash_error;
+    unsigned int                   lookup_key;
+
+    entries = malloc(sizeof(*entries)*ENTRIES_PER_THREAD*THREAD_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < STRIPE_COUNT; index++)
+        pthread_mutex_init(&stripes[index].mutex, NULL);
+
+    shash_error = Container_CreateSHashShift(
+                                             14,
+                                             STRIPE_COUNT,
+                                             sizeof(stripes[0]),
+                                             stripes,
+                                             &MyLock,
+                                             &MyUnlock,
+                                             &my_shash
+                                            );
+    if(shash_error != container__error_none)
+        return EXIT_FAILURE;
+
+    for(unsigned int index = 0; index < THREAD_COUNT; index++)
+    {
+        thread_data[index].first_key = index*ENTRIES_PER_THREAD;
+        thread_data[index].entries   = &entries[index*ENTRIES_PER_THREAD];
+        thread_data[index].shash     = &my_shash;
+
+        pthread_create(&threads[index], NULL, &MyThread, &thread_data[index]);
+    }
+
+    for(unsigned int index = 0; index < THREAD_COUNT; index++)
+        pthread_join(threads[index], NULL);
+
+    lookup_key = 31337;
+    found_node = Container_LookupSHashNode(
+                                           KeyHashValue(lookup_key),
+                                           &lookup_key,
+                                           &my_shash,
+                                           &MyHashLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+
+    found_entry = CONTAINER__CONTAINER_OF(found_node, struct my_data_entry, node);
+
+    printf("Found shash node with key: %u, value: %d\n", found_entry->my_key, found_entry->my_value);
+
+    Container_UnlockSHashBucket(searched_bucket, &my_shash);
+
+    Container_DestroySHash(&my_shash);
+
+    for(unsigned int index = 0; index < STRIPE_COUNT; index++)
+        pthread_mutex_destroy(&stripes[index].mutex);
+
+    free(entries);
+
+    return EXIT_SUCCESS;
+}
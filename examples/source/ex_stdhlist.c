@@ -0,0 +1,167 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <container/utils.h>
+#include <container/blob.h>
+#include <container/hlist.h>
+#include <container/stdhlist.h>
+
+
+#define HLIST_BUCKET_COUNT 64
+
+
+static void
+MakeBlob16 (const char* restrict, struct container__blob16* restrict);
+
+static void
+MakeBlob32 (const char* restrict, struct container__blob32* restrict);
+
+
+static void
+MakeBlob16 (const char* restrict name, struct container__blob16* restrict blob)
+{
+    size_t length;
+
+    /* Names longer than the key are cut short, and shorter ones are padded with zeros */
+    length = strlen(name);
+    if(length > sizeof(blob->bytes))
+        length = sizeof(blob->bytes);
+
+    memset(blob->bytes, 0, sizeof(blob->bytes));
+    memcpy(blob->bytes, name, length);
+}
+
+static void
+MakeBlob32 (const char* restrict name, struct container__blob32* restrict blob)
+{
+    size_t length;
+
+    /* Names longer than the key are cut short, and shorter ones are padded with zeros */
+    length = strlen(name);
+    if(length > sizeof(blob->bytes))
+        length = sizeof(blob->bytes);
+
+    memset(blob->bytes, 0, sizeof(blob->bytes));
+    memcpy(blob->bytes, name, length);
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    static const char* names[] = {"alpha", "bravo", "charlie", "delta"};
+
+    struct container__blob16_hlist_node id_nodes[4];
+    struct container__blob_hlist_node   name_nodes[4];
+    struct container__blob16_hlist_node extra_node;
+    struct container__hash_bucket       id_buckets[HLIST_BUCKET_COUNT];
+    struct container__hash_bucket       name_buckets[HLIST_BUCKET_COUNT];
+    struct container__hlist             id_hlist;
+    struct container__hlist             name_hlist;
+    struct container__hash_bucket*      searched_bucket;
+    struct container__hlist_node*       found_node;
+    struct container__blob16            lookup_id;
+    struct container__blob              lookup_name;
+    struct container__blob32            l_key;
+    struct container__blob32            r_key;
+
+    Container_InitHList(HLIST_BUCKET_COUNT, id_buckets, &id_hlist);
+    Container_InitHList(HLIST_BUCKET_COUNT, name_buckets, &name_hlist);
+
+    /* Fixed width keys are hashed by the caller, variable width keys carry their hash */
+    for(unsigned int index = 0; index < 4; index++)
+    {
+        struct container__blob16 id;
+        struct container__blob   name;
+
+        MakeBlob16(names[index], &id);
+        Container_InitBlob(names[index], strlen(names[index]), &name);
+
+        Container_AddBlob16HList(
+                                 id,
+                                 Container_HashBlob16(id),
+                                 &id_nodes[index],
+                                 NULL,
+                                 NULL,
+                                 NULL,
+                                 &id_hlist
+                                );
+
+        Container_AddBlobHList(name, &name_nodes[index], NULL, NULL, NULL, &name_hlist);
+    }
+
+    MakeBlob16("charlie", &lookup_id);
+
+    found_node = Container_LookupHListNode(
+                                           Container_HashBlob16(lookup_id),
+                                           &lookup_id,
+                                           &id_hlist,
+                                           &Container_Blob16HListLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+
+    printf("16 byte key 'charlie' %s\n", found_node != NULL ? "found" : "not found");
+
+    /* A failed lookup leaves the bucket to insert the missing key into */
+    MakeBlob16("echo", &lookup_id);
+
+    found_node = Container_LookupHListNode(
+                                           Container_HashBlob16(lookup_id),
+                                           &lookup_id,
+                                           &id_hlist,
+                                           &Container_Blob16HListLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+    if(found_node == NULL)
+    {
+        Container_InsBlob16HList(lookup_id, &extra_node, searched_bucket, &id_hlist);
+
+        printf("16 byte key 'echo' inserted after a failed lookup\n");
+    }
+
+    Container_InitBlob("delta", strlen("delta"), &lookup_name);
+
+    found_node = Container_LookupHListNode(
+                                           lookup_name.value_hash,
+                                           &lookup_name,
+                                           &name_hlist,
+                                           &Container_BlobHListLookup,
+                                           NULL,
+                                           &searched_bucket
+                                          );
+
+    printf("Variable width key 'delta' %s\n", found_node != NULL ? "found" : "not found");
+
+    MakeBlob32("alpha", &l_key);
+    MakeBlob32("bravo", &r_key);
+
+    printf("32 byte keys 'alpha' and 'bravo' are %s\n",
+           Container_Blob32HListTest(l_key, r_key) == container__hlist_node_equal ?
+           "equal" :
+           "not equal");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/*
+    The C container library is licensed under the simplified BSD license:
+
+    Copyright 2013, Andrew Gottemoller
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification,
+    are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this list of
+    conditions and the following disclaimer:
+
+    Redistributions in binary form must reproduce the above copyright notice, this list
+    of conditions and the following disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+    Neither the name Andrew Gottemoller nor the names of its contributors may be used to
+    endorse or promote products derived from this software without specific prior written
+    permission.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <container/utils.h>
+#include <container/hashfn.h>
+#include <container/thash.h>
+
+
+#define BUCKET_COUNT 64
+
+#define ENTRY_COUNT 4000
+
+
+/* The type we'll be adding to the thash */
+struct my_data_entry
+{
+    unsigned int my_key;
+    int          my_value;
+
+    /* Stores thash-specific node data */
+    struct container__thash_node node;
+};
+
+
+static inline unsigned int
+KeyHashValue (unsigned int, struct container__thash* restrict);
+
+static enum container__hash_cmp_result
+MyHashLookup (void*, struct container__thash_node* restrict, void*);
+
+
+/* Keys are hashed with the seed of the table, so equal hash values can't be arranged */
+static inline unsigned int
+KeyHashValue (unsigned int key, struct container__thash* restrict thash)
+{
+    return Container_HashBytes(&key, sizeof(key), Container_THashSeed(thash));
+}
+
+static enum container__hash_cmp_result
+MyHashLookup (void* lookup_key, struct container__thash_node* restrict cmp_node, void* user_data)
+{
+    struct my_data_entry* restrict entry;
+
+    entry = CONTAINER__CONTAINER_OF(cmp_node, struct my_data_entry, node);
+
+    if(*(unsigned int*)lookup_key == entry->my_key)
+        return container__hash_node_equal;
+
+    return container__hash_node_not_equal;
+}
+
+
+int main (int argument_count, char** arguments)
+{
+    struct my_data_entry*          entries;
+    struct container__thash        my_thash;
+    struct container__thash_node*  found_node;
+    struct my_data_entry* restrict found_entry;
+    enum container__error_code     thash_error;
+    unsigned int                   lookup_key;
+    unsigned int                   tree_count;
+
+    entries = malloc(sizeof(*entries)*ENTRY_COUNT);
+    if(entries == NULL)
+        return EXIT_FAILURE;
+
+    thash_error = Container_CreateTHash(BUCKET_COUNT, &my_thash);
+    if(thash_error != container__error_none)
+        return EXIT_FAILURE;
+
+    /* The table is overloaded, so every bucket grows long enough to become a tree */
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+    {
+        entries[index].my_key   = index;
+        entries[index].my_value = index*3;
+
+        Container_AddTHashNode(KeyHashValue(index, &my_thash), &entries[index].node, &my_thash);
+    }
+
+    tree_count = 0;
+    for(unsigned int index = 0; index < BUCKET_COUNT; index++)
+    {
+        if(Container_BSTState(&my_thash.buckets[index].node_tree) == container__bst_populated)
+            tree_count++;
+    }
+
+    printf("%u of %u buckets hold a tree\n", tree_count, BUCKET_COUNT);
+
+    lookup_key = 1337;
+    found_node = Container_LookupTHashNode(
+                                           KeyHashValue(lookup_key, &my_thash),
+                                           &lookup_key,
+                                           &my_thash,
+                                           &MyHashLookup,
+                                           NULL
+                                          );
+
+    found_entry = CONTAINER__CONTAINER_OF(found_node, struct my_data_entry, node);
+
+    printf("Found thash node with key: %u, value: %d\n", found_entry->my_key, found_entry->my_value);
+
+    /* Buckets return to lists as they empty */
+    for(unsigned int index = 0; index < ENTRY_COUNT; index++)
+    {
+        if(index != lookup_key)
+            Container_RemoveTHashNode(&entries[index].node, &my_thash);
+    }
+
+    found_node = Container_LookupTHashNode(
+                                           KeyHashValue(lookup_key, &my_thash),
+                                           &lookup_key,
+                                           &my_thash,
+                                           &MyHashLookup,
+                                           NULL
+                                          );
+
+    if(found_node == &entries[lookup_key].node)
+        printf("Found thash node with key: %u after removing the others\n", lookup_key);
+
+    Container_DestroyTHash(&my_thash);
+    free(entries);
+
+    return EXIT_SUCCESS;
+}